@@ -0,0 +1,461 @@
+//! Headless PhysicManager benchmark.
+//! Builds canned scenarios from scene objects and physic components without initializing the scene graphics,
+//! steps them with a fixed frame time and prints the PhysicManager profile report of each scenario as JSON.
+//!
+//! Usage: PhysicBenchmark [--scenario <name|all>] [--frames <count>] [--warmup <count>] [--output <file>] [--list]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <btBulletDynamicsCommon.h>
+#include <BulletSoftBody/btSoftBody.h>
+
+#include "scene/Scene.h"
+#include "scene/SceneManager.h"
+#include "scene/SceneObject.h"
+#include "components/physic/PhysicManager.h"
+#include "components/physic/Rigidbody.h"
+#include "components/physic/Softbody.h"
+#include "components/physic/collider/BoxCollider.h"
+#include "components/physic/collider/SphereCollider.h"
+#include "components/physic/collider/CapsuleCollider.h"
+#include "components/physic/collider/HeightfieldCollider.h"
+
+#include "utils/filesystem.h"
+namespace fs = ghc::filesystem;
+
+using namespace ige::scene;
+
+namespace
+{
+    //! Frame time of the benchmark
+    constexpr float FRAME_TIME = 1.f / 60.f;
+
+    //! Scenario state
+    struct BenchmarkContext
+    {
+        std::shared_ptr<Scene> scene;
+        std::shared_ptr<PhysicManager> manager;
+        std::mt19937 random{ 12345 };
+        std::vector<std::shared_ptr<Rigidbody>> movers;
+        std::vector<std::unique_ptr<btTypedConstraint>> constraints;
+        std::string workDir;
+        int objects = 0;
+        int triggerEvents = 0;
+        int raycasts = 0;
+        int raycastHits = 0;
+
+        float randomRange(float min, float max)
+        {
+            return std::uniform_real_distribution<float>(min, max)(random);
+        }
+    };
+
+    //! Canned scenario
+    struct Scenario
+    {
+        const char* name;
+        bool deformable;
+        std::function<void(BenchmarkContext&)> setup;
+        std::function<void(BenchmarkContext&, int)> update;
+    };
+
+    //! Create a rigidbody object, the collider is configured before the body is created
+    template <typename T>
+    std::shared_ptr<Rigidbody> createBody(BenchmarkContext& ctx, const std::string& name, const Vec3& position, float mass, const std::function<void(T&)>& setupCollider, const std::function<void(Rigidbody&)>& setupBody = nullptr)
+    {
+        auto obj = ctx.scene->createObject(name, nullptr, false, { 64.f, 64.f }, std::string(), position);
+        auto collider = obj->addComponent<T>();
+        setupCollider(*collider);
+        auto body = obj->addComponent<Rigidbody>();
+        body->setMass(mass);
+        if (setupBody) setupBody(*body);
+        body->init();
+        ++ctx.objects;
+        return body;
+    }
+
+    std::shared_ptr<Rigidbody> createBox(BenchmarkContext& ctx, const std::string& name, const Vec3& position, const Vec3& halfSize, float mass, const std::function<void(Rigidbody&)>& setupBody = nullptr)
+    {
+        return createBody<BoxCollider>(ctx, name, position, mass, [&](BoxCollider& collider) { collider.setSize(halfSize); }, setupBody);
+    }
+
+    std::shared_ptr<Rigidbody> createSphere(BenchmarkContext& ctx, const std::string& name, const Vec3& position, float radius, float mass)
+    {
+        return createBody<SphereCollider>(ctx, name, position, mass, [&](SphereCollider& collider) { collider.setRadius(radius); });
+    }
+
+    std::shared_ptr<Rigidbody> createCapsule(BenchmarkContext& ctx, const std::string& name, const Vec3& position, float radius, float height, float mass)
+    {
+        return createBody<CapsuleCollider>(ctx, name, position, mass, [&](CapsuleCollider& collider) {
+            collider.setRadius(radius);
+            collider.setHeight(height);
+        });
+    }
+
+    void createGround(BenchmarkContext& ctx, float halfExtent)
+    {
+        createBox(ctx, "Ground", { 0.f, -0.5f, 0.f }, { halfExtent, 0.5f, halfExtent }, 0.f);
+    }
+
+    //! Box pyramid: deep contact stacks, dominated by the constraint solver
+    void setupBoxStack(BenchmarkContext& ctx)
+    {
+        createGround(ctx, 50.f);
+        const int baseSize = 20;
+        for (int layer = 0; layer < baseSize; ++layer)
+        {
+            const int rowSize = baseSize - layer;
+            for (int i = 0; i < rowSize; ++i)
+            {
+                for (int j = 0; j < 2; ++j)
+                {
+                    Vec3 position((i - rowSize * 0.5f) * 1.01f + 0.5f, layer + 0.5f, j * 1.01f);
+                    createBox(ctx, "Box", position, { 0.5f, 0.5f, 0.5f }, 1.f);
+                }
+            }
+        }
+    }
+
+    //! 2000 static triggers crossed by moving spheres: broadphase pairs and contact event dispatch
+    void setupTriggers(BenchmarkContext& ctx)
+    {
+        createGround(ctx, 60.f);
+        for (int i = 0; i < 2000; ++i)
+        {
+            Vec3 position((i % 50 - 25) * 2.f, 1.f + (i / 50 % 2) * 2.f, (i / 100 - 10) * 4.f);
+            auto trigger = createBox(ctx, "Trigger", position, { 0.75f, 0.75f, 0.75f }, 0.f, [](Rigidbody& body) {
+                body.setIsTrigger(true);
+                body.setContactReportFlags(CONTACT_REPORT_ENTER | CONTACT_REPORT_EXIT);
+            });
+            trigger->getTriggerStartEvent().addListener([&ctx](auto) { ++ctx.triggerEvents; });
+            trigger->getTriggerStopEvent().addListener([&ctx](auto) { ++ctx.triggerEvents; });
+        }
+        for (int i = 0; i < 256; ++i)
+        {
+            Vec3 position(ctx.randomRange(-45.f, 45.f), ctx.randomRange(1.f, 3.f), ctx.randomRange(-38.f, 38.f));
+            auto body = createSphere(ctx, "Mover", position, 0.4f, 1.f);
+            body->setGravityEnabled(false);
+            body->setActivationState(DISABLE_DEACTIVATION);
+            ctx.movers.push_back(body);
+        }
+    }
+
+    void updateTriggers(BenchmarkContext& ctx, int frame)
+    {
+        // Bounded sweep around the start position, so movers keep entering and leaving triggers
+        const float time = frame * FRAME_TIME;
+        for (size_t i = 0; i < ctx.movers.size(); ++i)
+        {
+            const float phase = (float)i * 0.37f;
+            ctx.movers[i]->setLinearVelocity(btVector3(std::cos(time + phase) * 6.f, 0.f, std::sin(time * 0.7f + phase) * 6.f));
+        }
+    }
+
+    //! Write a procedural square 16-bit little endian height map
+    std::string writeHeightMap(const std::string& dir, int side)
+    {
+        auto path = (fs::path(dir) / "physic_benchmark_terrain.r16").string();
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        for (int z = 0; z < side; ++z)
+        {
+            for (int x = 0; x < side; ++x)
+            {
+                float h = 0.5f + 0.25f * std::sin(x * 0.09f) * std::cos(z * 0.07f) + 0.2f * std::sin((x + z) * 0.031f);
+                auto value = (uint16_t)(std::min(std::max(h, 0.f), 1.f) * 65535.f);
+                file.put((char)(value & 0xFF));
+                file.put((char)(value >> 8));
+            }
+        }
+        return path;
+    }
+
+    //! Heightfield terrain with rolling spheres and a batch of ray casts each frame
+    void setupTerrainRaycast(BenchmarkContext& ctx)
+    {
+        auto path = writeHeightMap(ctx.workDir, 257);
+        createBody<HeightfieldCollider>(ctx, "Terrain", Vec3(), 0.f, [&](HeightfieldCollider& collider) {
+            collider.setTerrainSize({ 200.f, 200.f });
+            collider.setHeightRange({ 0.f, 20.f });
+            collider.setPath(path);
+        });
+        for (int i = 0; i < 100; ++i)
+        {
+            Vec3 position(ctx.randomRange(-80.f, 80.f), ctx.randomRange(25.f, 40.f), ctx.randomRange(-80.f, 80.f));
+            createSphere(ctx, "Ball", position, 0.5f, 1.f);
+        }
+    }
+
+    void updateTerrainRaycast(BenchmarkContext& ctx, int frame)
+    {
+        // Deterministic grid of vertical rays, shifted each frame
+        const int numRays = 2000;
+        for (int i = 0; i < numRays; ++i)
+        {
+            float x = -95.f + std::fmod(i * 4.75f + frame * 0.3f, 190.f);
+            float z = -95.f + std::fmod((i / 40) * 3.8f + frame * 0.2f, 190.f);
+            auto hit = ctx.manager->rayTestClosest(btVector3(x, 50.f, z), btVector3(x, -10.f, z));
+            if (hit.object) ++ctx.raycastHits;
+        }
+        ctx.raycasts += numRays;
+    }
+
+    //! Join two bodies with a cone twist constraint at the given world pivot
+    void joinBodies(BenchmarkContext& ctx, const std::shared_ptr<Rigidbody>& bodyA, const std::shared_ptr<Rigidbody>& bodyB, const btVector3& pivot, float swing, float twist)
+    {
+        auto* rbA = bodyA->getBody();
+        auto* rbB = bodyB->getBody();
+        btTransform frameA, frameB;
+        frameA.setIdentity();
+        frameB.setIdentity();
+        frameA.setOrigin(rbA->getWorldTransform().inverse()(pivot));
+        frameB.setOrigin(rbB->getWorldTransform().inverse()(pivot));
+        auto constraint = std::make_unique<btConeTwistConstraint>(*rbA, *rbB, frameA, frameB);
+        constraint->setLimit(swing, swing, twist);
+        ctx.manager->getWorld()->addConstraint(constraint.get(), true);
+        ctx.constraints.push_back(std::move(constraint));
+    }
+
+    //! Pile of 11 part ragdolls: many constraints and mixed shapes in contact
+    void setupRagdollPile(BenchmarkContext& ctx)
+    {
+        createGround(ctx, 40.f);
+        for (int r = 0; r < 30; ++r)
+        {
+            const btVector3 base(ctx.randomRange(-3.f, 3.f), 2.f + r * 1.2f, ctx.randomRange(-3.f, 3.f));
+            auto at = [&](float x, float y, float z) { return Vec3(base.x() + x, base.y() + y, base.z() + z); };
+            auto pivot = [&](float x, float y, float z) { return base + btVector3(x, y, z); };
+
+            auto pelvis = createBox(ctx, "Pelvis", at(0.f, 0.f, 0.f), { 0.2f, 0.1f, 0.1f }, 3.f);
+            auto chest = createBox(ctx, "Chest", at(0.f, 0.35f, 0.f), { 0.2f, 0.2f, 0.1f }, 3.f);
+            auto head = createSphere(ctx, "Head", at(0.f, 0.72f, 0.f), 0.12f, 1.f);
+            auto upperArmL = createCapsule(ctx, "UpperArmL", at(-0.4f, 0.45f, 0.f), 0.05f, 0.2f, 0.5f);
+            auto lowerArmL = createCapsule(ctx, "LowerArmL", at(-0.75f, 0.45f, 0.f), 0.04f, 0.2f, 0.4f);
+            auto upperArmR = createCapsule(ctx, "UpperArmR", at(0.4f, 0.45f, 0.f), 0.05f, 0.2f, 0.5f);
+            auto lowerArmR = createCapsule(ctx, "LowerArmR", at(0.75f, 0.45f, 0.f), 0.04f, 0.2f, 0.4f);
+            auto upperLegL = createCapsule(ctx, "UpperLegL", at(-0.12f, -0.35f, 0.f), 0.07f, 0.3f, 1.f);
+            auto lowerLegL = createCapsule(ctx, "LowerLegL", at(-0.12f, -0.85f, 0.f), 0.05f, 0.3f, 0.8f);
+            auto upperLegR = createCapsule(ctx, "UpperLegR", at(0.12f, -0.35f, 0.f), 0.07f, 0.3f, 1.f);
+            auto lowerLegR = createCapsule(ctx, "LowerLegR", at(0.12f, -0.85f, 0.f), 0.05f, 0.3f, 0.8f);
+
+            joinBodies(ctx, pelvis, chest, pivot(0.f, 0.15f, 0.f), 0.5f, 0.3f);
+            joinBodies(ctx, chest, head, pivot(0.f, 0.58f, 0.f), 0.6f, 0.5f);
+            joinBodies(ctx, chest, upperArmL, pivot(-0.22f, 0.45f, 0.f), 1.2f, 0.5f);
+            joinBodies(ctx, upperArmL, lowerArmL, pivot(-0.58f, 0.45f, 0.f), 1.f, 0.2f);
+            joinBodies(ctx, chest, upperArmR, pivot(0.22f, 0.45f, 0.f), 1.2f, 0.5f);
+            joinBodies(ctx, upperArmR, lowerArmR, pivot(0.58f, 0.45f, 0.f), 1.f, 0.2f);
+            joinBodies(ctx, pelvis, upperLegL, pivot(-0.12f, -0.1f, 0.f), 0.8f, 0.3f);
+            joinBodies(ctx, upperLegL, lowerLegL, pivot(-0.12f, -0.6f, 0.f), 1.f, 0.1f);
+            joinBodies(ctx, pelvis, upperLegR, pivot(0.12f, -0.1f, 0.f), 0.8f, 0.3f);
+            joinBodies(ctx, upperLegR, lowerLegR, pivot(0.12f, -0.6f, 0.f), 1.f, 0.1f);
+        }
+    }
+
+    //! Fill an empty soft body with a pinned square cloth patch
+    void buildClothPatch(btSoftBody* body, const btVector3& center, float halfSize, int res, float mass)
+    {
+        for (int z = 0; z < res; ++z)
+            for (int x = 0; x < res; ++x)
+                body->appendNode(center + btVector3(-halfSize + 2.f * halfSize * x / (res - 1), 0.f, -halfSize + 2.f * halfSize * z / (res - 1)), 1.f);
+
+        auto idx = [res](int x, int z) { return z * res + x; };
+        for (int z = 0; z < res; ++z)
+        {
+            for (int x = 0; x < res; ++x)
+            {
+                if (x + 1 < res) body->appendLink(idx(x, z), idx(x + 1, z));
+                if (z + 1 < res) body->appendLink(idx(x, z), idx(x, z + 1));
+                if (x + 1 < res && z + 1 < res)
+                {
+                    body->appendLink(idx(x, z), idx(x + 1, z + 1));
+                    body->appendFace(idx(x, z), idx(x + 1, z), idx(x + 1, z + 1));
+                    body->appendFace(idx(x, z), idx(x + 1, z + 1), idx(x, z + 1));
+                }
+            }
+        }
+        body->setTotalMass(mass);
+        body->generateBendingConstraints(2);
+        body->setMass(idx(0, 0), 0.f);
+        body->setMass(idx(res - 1, 0), 0.f);
+    }
+
+    //! Cloth patches draped over a static sphere: soft body solver and soft/rigid contacts
+    void setupCloth(BenchmarkContext& ctx)
+    {
+        createGround(ctx, 30.f);
+        createSphere(ctx, "Obstacle", { 0.f, 2.f, 0.f }, 1.5f, 0.f);
+        for (int i = 0; i < 8; ++i)
+        {
+            const btVector3 center((i % 4 - 1.5f) * 1.2f, 4.f + i * 0.6f, (i / 4 - 0.5f) * 1.2f);
+            auto obj = ctx.scene->createObject("Cloth", nullptr, false, { 64.f, 64.f }, std::string(), Vec3(center.x(), center.y(), center.z()));
+            auto body = obj->addComponent<Softbody>();
+            body->init();
+
+            // Nodes are appended while out of the world, so the broadphase proxy is created with the final bounds
+            body->setEnabled(false);
+            buildClothPatch(body->getSoftBody(), center, 1.5f, 32, 1.f);
+            body->setEnabled(true);
+            ++ctx.objects;
+        }
+    }
+
+    const std::vector<Scenario>& getScenarios()
+    {
+        static const std::vector<Scenario> scenarios = {
+            { "box_stack", false, setupBoxStack, nullptr },
+            { "triggers", false, setupTriggers, updateTriggers },
+            { "terrain_raycast", false, setupTerrainRaycast, updateTerrainRaycast },
+            { "ragdoll_pile", false, setupRagdollPile, nullptr },
+            { "cloth", true, setupCloth, nullptr },
+        };
+        return scenarios;
+    }
+
+    //! Build, step and tear down one scenario
+    json runScenario(const Scenario& scenario, int frames, int warmup, const std::string& workDir)
+    {
+        BenchmarkContext ctx;
+        ctx.workDir = workDir;
+
+        auto setupStart = std::chrono::high_resolution_clock::now();
+        ctx.scene = std::make_shared<Scene>(scenario.name);
+        auto root = ctx.scene->createObject("root");
+        ctx.manager = root->addComponent<PhysicManager>(scenario.deformable);
+        ctx.manager->initialize();
+        scenario.setup(ctx);
+        auto setupTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - setupStart).count();
+
+        for (int i = 0; i < warmup; ++i)
+        {
+            if (scenario.update) scenario.update(ctx, i);
+            ctx.scene->physicUpdate(FRAME_TIME);
+        }
+
+        // Only measured frames are profiled
+        ctx.triggerEvents = ctx.raycasts = ctx.raycastHits = 0;
+        ctx.manager->setProfiling(true);
+        float frameTime = 0.f, maxFrameTime = 0.f;
+        for (int i = 0; i < frames; ++i)
+        {
+            auto frameStart = std::chrono::high_resolution_clock::now();
+            if (scenario.update) scenario.update(ctx, warmup + i);
+            ctx.scene->physicUpdate(FRAME_TIME);
+            auto elapsed = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - frameStart).count();
+            frameTime += elapsed;
+            maxFrameTime = std::max(maxFrameTime, elapsed);
+        }
+
+        json result = json{
+            {"scenario", scenario.name},
+            {"objects", ctx.objects},
+            {"frames", frames},
+            {"setupTime", setupTime},
+            {"frameTime", frames > 0 ? frameTime / frames : 0.f},
+            {"maxFrameTime", maxFrameTime},
+            {"report", ctx.manager->getProfileReport()},
+        };
+        if (std::strcmp(scenario.name, "triggers") == 0)
+            result["triggerEvents"] = ctx.triggerEvents;
+        if (ctx.raycasts > 0)
+        {
+            result["raycasts"] = ctx.raycasts;
+            result["raycastHits"] = ctx.raycastHits;
+        }
+
+        // Constraints are owned here, remove them before their bodies are destroyed
+        for (auto& constraint : ctx.constraints)
+            ctx.manager->getWorld()->removeConstraint(constraint.get());
+        ctx.constraints.clear();
+        ctx.movers.clear();
+        ctx.manager.reset();
+        root.reset();
+        ctx.scene->clear();
+        ctx.scene.reset();
+        return result;
+    }
+
+    void printUsage()
+    {
+        std::cout << "Usage: PhysicBenchmark [--scenario <name|all>] [--frames <count>] [--warmup <count>] [--output <file>] [--list]" << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::string scenarioName = "all";
+    std::string output;
+    int frames = 600;
+    int warmup = 60;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--scenario" && hasValue)
+            scenarioName = argv[++i];
+        else if (arg == "--frames" && hasValue)
+            frames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup" && hasValue)
+            warmup = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--output" && hasValue)
+            output = argv[++i];
+        else if (arg == "--list")
+        {
+            for (const auto& scenario : getScenarios())
+                std::cout << scenario.name << std::endl;
+            return 0;
+        }
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    // Step the simulation without the editor or the Python runtime
+    SceneManager::getInstance()->setIsPlaying(true);
+
+    auto workDir = output.empty() ? fs::temp_directory_path() : fs::absolute(fs::path(output)).parent_path();
+    json results = json::array();
+    for (const auto& scenario : getScenarios())
+    {
+        if (scenarioName != "all" && scenarioName != scenario.name)
+            continue;
+        std::cerr << "Running " << scenario.name << "..." << std::endl;
+        results.push_back(runScenario(scenario, frames, warmup, workDir.string()));
+    }
+
+    if (results.empty())
+    {
+        std::cerr << "Unknown scenario: " << scenarioName << std::endl;
+        return 1;
+    }
+
+    auto report = json{ {"frameTime", FRAME_TIME}, {"scenarios", results} }.dump(2);
+    if (output.empty())
+    {
+        std::cout << report << std::endl;
+    }
+    else
+    {
+        std::ofstream file(output, std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::cerr << "Cannot write " << output << std::endl;
+            return 1;
+        }
+        file << report << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+"""
+Run the headless physic benchmark scenarios and compare them with a baseline.
+
+usage: run_benchmark.py --exe <PhysicBenchmark> [--scenario name ...] [--frames N] [--warmup N]
+                        [--output result.json] [--baseline baseline.json] [--threshold percent]
+
+Each scenario runs in its own process, so one scenario cannot warm caches or leak state into the next.
+With --baseline, steps/sec of every scenario is compared and the script exits with 1 when one of them
+regressed by more than the threshold.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def list_scenarios(exe):
+    output = subprocess.run([exe, '--list'], check=True, capture_output=True, text=True).stdout
+    return [line.strip() for line in output.splitlines() if line.strip()]
+
+
+def run_scenario(exe, scenario, frames, warmup, work_dir):
+    output = os.path.join(work_dir, scenario + '.json')
+    subprocess.run([exe, '--scenario', scenario, '--frames', str(frames), '--warmup', str(warmup), '--output', output], check=True)
+    with open(output) as f:
+        return json.load(f)['scenarios'][0]
+
+
+def steps_per_sec(result):
+    return result.get('report', {}).get('stepsPerSec', 0.0)
+
+
+def compare(results, baseline, threshold):
+    base = {r['scenario']: r for r in baseline.get('scenarios', [])}
+    regressed = False
+    print('{:<18}{:>14}{:>14}{:>10}{:>14}'.format('scenario', 'base steps/s', 'steps/s', 'delta', 'frame (ms)'))
+    for result in results:
+        name = result['scenario']
+        current = steps_per_sec(result)
+        previous = steps_per_sec(base[name]) if name in base else 0.0
+        if previous > 0.0:
+            delta = (current - previous) / previous * 100.0
+            if delta < -threshold:
+                regressed = True
+            delta_text = '{:+.1f}%'.format(delta)
+        else:
+            delta_text = 'n/a'
+        print('{:<18}{:>14.1f}{:>14.1f}{:>10}{:>14.3f}'.format(name, previous, current, delta_text, result.get('frameTime', 0.0)))
+    return regressed
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run the headless physic benchmark')
+    parser.add_argument('--exe', required=True, help='path to the PhysicBenchmark executable')
+    parser.add_argument('--scenario', action='append', help='scenario to run, all scenarios when omitted')
+    parser.add_argument('--frames', type=int, default=600, help='measured frames per scenario')
+    parser.add_argument('--warmup', type=int, default=60, help='frames stepped before measuring')
+    parser.add_argument('--output', help='merged result file')
+    parser.add_argument('--baseline', help='result file of a previous run to compare with')
+    parser.add_argument('--threshold', type=float, default=5.0, help='allowed steps/sec regression in percent')
+    args = parser.parse_args()
+
+    scenarios = args.scenario or list_scenarios(args.exe)
+    with tempfile.TemporaryDirectory() as work_dir:
+        results = [run_scenario(args.exe, scenario, args.frames, args.warmup, work_dir) for scenario in scenarios]
+
+    merged = {'frames': args.frames, 'warmup': args.warmup, 'scenarios': results}
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(merged, f, indent=2)
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        if compare(results, baseline, args.threshold):
+            print('Steps/sec regressed by more than {}%'.format(args.threshold))
+            return 1
+    else:
+        compare(results, {}, args.threshold)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -45,6 +45,7 @@ namespace ige::scene
                         auto jointName = m_figure->GetJointName(i);
                         m_jointObjects[jointName] = getOwner()->findChildByName(jointName);
                     }
+                    m_bJointBindingsDirty = true;
                     return true;
                 }
             }
@@ -59,6 +60,8 @@ namespace ige::scene
             m_jointObjects[key] = nullptr;
         }
         m_jointObjects.clear();
+        m_jointBindings.clear();
+        m_bJointBindingsDirty = true;
     }
 
     void BoneTransform::onJointObjectSelected(const std::string& name, bool selected)
@@ -90,36 +93,61 @@ namespace ige::scene
                         getOwner()->getScene()->removeObjectById(m_jointObjects[jointName]->getId());
                     m_jointObjects[jointName] = nullptr;
                 }
+                m_bJointBindingsDirty = true;
             }
         }
     }
 
+    //! Resolve joint objects to joint indices
+    void BoneTransform::updateJointBindings()
+    {
+        m_jointBindings.clear();
+        if (m_figure)
+        {
+            auto numJoints = m_figure->NumJoints();
+            for (const auto& [name, jointObj] : m_jointObjects)
+            {
+                if (jointObj == nullptr)
+                    continue;
+                auto idx = m_figure->GetJointIndex(GenerateNameHash(name.c_str()));
+                if (idx >= 0 && idx < numJoints)
+                    m_jointBindings.push_back({ idx, jointObj->getTransform() });
+            }
+            std::sort(m_jointBindings.begin(), m_jointBindings.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.jointIndex < rhs.jointIndex;
+            });
+        }
+        m_bJointBindingsDirty = false;
+    }
+
     //! Update
     void BoneTransform::onUpdate(float dt)
     {
         if (m_figure)
         {
-            auto numJoints = m_figure->NumJoints();
-            for (int i = 0; i < numJoints; ++i)
+            if (m_bJointBindingsDirty)
+                updateJointBindings();
+
+            // Only joints with attached objects are synced
+            for (const auto& binding : m_jointBindings)
             {
-                auto jointName = m_figure->GetJointName(i);
-                auto joint = m_figure->GetJoint(i, Space::WorldSpace);
-                auto jointObj = m_jointObjects[jointName];
-                if (jointObj)
-                {
-                    auto transform = jointObj->getTransform();
-                    transform->setPosition(joint.translation);
-                    transform->setRotation(joint.rotation);
-                    transform->setScale({ joint.scale[0], joint.scale[1], joint.scale[2] });
-                }
+                auto joint = m_figure->GetJoint(binding.jointIndex, Space::WorldSpace);
+                binding.transform->setPosition(joint.translation);
+                binding.transform->setRotation(joint.rotation);
+                binding.transform->setScale({ joint.scale[0], joint.scale[1], joint.scale[2] });
             }
         }
     }
 
     void BoneTransform::onSceneObjectDeleted(SceneObject& sceneObject)
     {
-        if(m_jointObjects.count(sceneObject.getName()))
-            m_jointObjects[sceneObject.getName()] = nullptr;
+        auto itr = m_jointObjects.find(sceneObject.getName());
+        if (itr != m_jointObjects.end() && itr->second.get() == &sceneObject)
+        {
+            itr->second = nullptr;
+            m_jointBindings.clear();
+            m_bJointBindingsDirty = true;
+        }
     }
 
     //! Update
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include "utils/PyxieHeaders.h"
 using namespace pyxie;
@@ -10,6 +11,8 @@ using namespace pyxie;
 
 namespace ige::scene
 {
+    class TransformComponent;
+
     //! BoneTransform
     class BoneTransform : public Component
     {
@@ -66,10 +69,26 @@ namespace ige::scene
         //! SceneObject deleted event
         void onSceneObjectDeleted(SceneObject& sceneObject);
 
+        //! Resolve joint objects to joint indices
+        void updateJointBindings();
+
     protected:
+        //! Joint index and transform of an attached joint object
+        struct JointBinding
+        {
+            int jointIndex;
+            std::shared_ptr<TransformComponent> transform;
+        };
+
         //! Store all object created by BoneTransform
         std::unordered_map<std::string, std::shared_ptr<SceneObject>> m_jointObjects = {};
 
+        //! Attached joint objects by joint index, synced each update
+        std::vector<JointBinding> m_jointBindings;
+
+        //! Joint objects changed, bindings need to be resolved again
+        bool m_bJointBindingsDirty = true;
+
         //! Cache the figure object
         Figure* m_figure = nullptr;
 
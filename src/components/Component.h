@@ -65,7 +65,9 @@ namespace ige::scene
             Transform,
             RectTransform,
             Compound,
-            Animator
+            Animator,
+            HeightfieldCollider,
+            CharacterController
         };
 
     public:
@@ -35,15 +35,16 @@ namespace ige::scene
             return;
 
         // Update transform from transform component
-        auto transform = getOwner()->getTransform();
-        m_figure->SetPosition(transform->getPosition());
-        m_figure->SetRotation(transform->getRotation());
-        m_figure->SetScale(transform->getScale());
+        syncTransform();
 
-        // Update
-        m_figure->Step(dt * getFrameUpdateRatio());
+        // Update, animated figures are stepped in the scene animation phase
+        if (m_bAnimationStepped)
+            m_bAnimationStepped = false;
+        else
+            m_figure->Step(dt * getFrameUpdateRatio());
 
         // Update transform back to transform component
+        auto transform = getOwner()->getTransform();
         transform->setPosition(m_figure->GetPosition());
         transform->setRotation(m_figure->GetRotation());
         transform->setScale(m_figure->GetScale());
@@ -51,6 +52,15 @@ namespace ige::scene
             pyxie_printf("f Update\n");
     }
 
+    //! Copy the owner transform to the figure
+    void EditableFigureComponent::syncTransform()
+    {
+        auto transform = getOwner()->getTransform();
+        m_figure->SetPosition(transform->getPosition());
+        m_figure->SetRotation(transform->getRotation());
+        m_figure->SetScale(transform->getScale());
+    }
+
     //! Render
     void EditableFigureComponent::onRender()
     {    
@@ -43,15 +43,24 @@ namespace ige::scene
             return;
 
         // Update transform from transform component
+        syncTransform();
+
+        // Update, animated figures are stepped in the scene animation phase
+        if (m_bAnimationStepped) {
+            m_bAnimationStepped = false;
+        }
+        else if (SceneManager::getInstance()->isPlaying()) {
+            m_figure->Step(dt * getFrameUpdateRatio());
+        }
+    }
+
+    //! Copy the owner transform to the figure
+    void FigureComponent::syncTransform()
+    {
         auto transform = getOwner()->getTransform();
         m_figure->SetPosition(transform->getPosition());
         m_figure->SetRotation(transform->getRotation());
         m_figure->SetScale(transform->getScale());
-
-        // Update
-        if (SceneManager::getInstance()->isPlaying()) {
-            m_figure->Step(dt * getFrameUpdateRatio());
-        }
     }
 
     //! Render
@@ -117,6 +117,12 @@ namespace ige::scene
         float getFrameUpdateRatio() const { return m_frameUpdateRatio; };
         void setFrameUpdateRatio(float ratio) { m_frameUpdateRatio = ratio; }
 
+        //! Copy the owner transform to the figure
+        void syncTransform();
+
+        //! Figure already stepped by the scene animation phase this frame
+        void setAnimationStepped() { m_bAnimationStepped = true; }
+
         //! Update property by key value
         virtual void setProperty(const std::string& key, const json& val) override;
 
@@ -149,6 +155,9 @@ namespace ige::scene
         //! Frame update ratio (speedup/slower effects)
         float m_frameUpdateRatio = 1.f;
 
+        //! Stepped by the scene animation phase, skip the step in onUpdate
+        bool m_bAnimationStepped = false;
+
         //! Cache fog state
         bool m_bIsFogEnabled = false;
 
@@ -312,37 +312,30 @@ namespace ige::scene
             return;
 
         auto physicComp = getOwner()->getComponent<Rigidbody>();
-        if (physicComp != nullptr)
-        {
-            physicComp->getTriggerStartEvent().addListener([this](auto other) {
-                auto otherObject = other->getOwner();
-                onTriggerStart(*otherObject);
-            });
-
-            physicComp->getTriggerStayEvent().addListener([this](auto other) {
-                auto otherObject = other->getOwner();
-                onTriggerStay(*otherObject);
-            });
-
-            physicComp->getTriggerStopEvent().addListener([this](auto other) {
-                auto otherObject = other->getOwner();
-                onTriggerStop(*otherObject);
-            });
-
-            physicComp->getCollisionStartEvent().addListener([this](auto other) {
-                auto otherObject = other->getOwner();
-                onCollisionStart(*otherObject);
-            });
-
-            physicComp->getCollisionStayEvent().addListener([this](auto other) {
-                auto otherObject = other->getOwner();
-                onCollisionStay(*otherObject);
-            });
-
-            physicComp->getCollisionStayEvent().addListener([this](auto other) {
-                auto otherObject = other->getOwner();
-                onCollisionStop(*otherObject);
-            });
+        if (physicComp != nullptr && m_pyInstance != nullptr)
+        {
+            // Only listen to implemented callbacks, and opt the body in to report those contact phases at runtime
+            int reportFlags = CONTACT_REPORT_NONE;
+            auto addContactListener = [&](const char* method, Event<Rigidbody*>& event, void (ScriptComponent::*callback)(SceneObject&), int flag) {
+                if (!PyObject_HasAttrString(m_pyInstance, method))
+                    return;
+                auto id = event.addListener([this, callback](auto other) {
+                    auto otherObject = other->getOwner();
+                    (this->*callback)(*otherObject);
+                });
+                m_contactListeners.push_back({ &event, id });
+                reportFlags |= flag;
+            };
+
+            addContactListener("onTriggerStart", physicComp->getTriggerStartEvent(), &ScriptComponent::onTriggerStart, CONTACT_REPORT_ENTER);
+            addContactListener("onTriggerStay", physicComp->getTriggerStayEvent(), &ScriptComponent::onTriggerStay, CONTACT_REPORT_STAY);
+            addContactListener("onTriggerStop", physicComp->getTriggerStopEvent(), &ScriptComponent::onTriggerStop, CONTACT_REPORT_EXIT);
+            addContactListener("onCollisionStart", physicComp->getCollisionStartEvent(), &ScriptComponent::onCollisionStart, CONTACT_REPORT_ENTER);
+            addContactListener("onCollisionStay", physicComp->getCollisionStayEvent(), &ScriptComponent::onCollisionStay, CONTACT_REPORT_STAY);
+            addContactListener("onCollisionStop", physicComp->getCollisionStopEvent(), &ScriptComponent::onCollisionStop, CONTACT_REPORT_EXIT);
+
+            m_contactBody = physicComp;
+            physicComp->setScriptReportFlags(this, reportFlags);
         }
 
         auto particleComp = getOwner()->getComponent<Particle>();
@@ -359,17 +352,15 @@ namespace ige::scene
         if (getOwner() == nullptr)
             return;
 
-        auto physicComp = getOwner()->getComponent<Rigidbody>();
-        if (physicComp != nullptr)
+        // Remove only the listeners and report flags of this script, the body keeps those of other scripts
+        if (auto physicComp = m_contactBody.lock())
         {
-            physicComp->getTriggerStartEvent().removeAllListeners();
-            physicComp->getTriggerStayEvent().removeAllListeners();
-            physicComp->getTriggerStopEvent().removeAllListeners();
-
-            physicComp->getCollisionStartEvent().removeAllListeners();
-            physicComp->getCollisionStayEvent().removeAllListeners();
-            physicComp->getCollisionStayEvent().removeAllListeners();
+            for (const auto& [event, id] : m_contactListeners)
+                event->removeListener(id);
+            physicComp->setScriptReportFlags(this, CONTACT_REPORT_NONE);
         }
+        m_contactListeners.clear();
+        m_contactBody.reset();
 
         auto particleComp = getOwner()->getComponent<Particle>();
         if (particleComp) {
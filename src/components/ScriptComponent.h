@@ -9,6 +9,7 @@ struct _object;
 namespace ige::scene
 {
     class EventContext;
+    class Rigidbody;
     //! ScriptComponent
     class ScriptComponent : public RuntimeComponent
     {
@@ -166,5 +167,9 @@ namespace ige::scene
 
         //! Python class members
         std::unordered_map<std::string, json> m_members;
+
+        //! Contact listeners of this script, listeners of other scripts on the object are kept on unregister
+        std::weak_ptr<Rigidbody> m_contactBody;
+        std::vector<std::pair<Event<Rigidbody*>*, uint64_t>> m_contactListeners;
     };
 } // namespace ige::scene
@@ -180,6 +180,25 @@ namespace ige::scene
         return m_worldRotation;
     }
 
+    void TransformComponent::setWorldTransform(const Vec3& pos, const Quat& rot)
+    {
+        bool changed = false;
+        if (m_worldPosition != pos && !isLockMove())
+        {
+            m_worldPosition = pos;
+            changed = true;
+        }
+
+        if (m_worldRotation != rot && !isLockRotate())
+        {
+            m_worldRotation = rot;
+            changed = true;
+        }
+
+        if (changed)
+            updateWorldToLocal();
+    }
+
     void TransformComponent::setLocalScale(const Vec3 &scale)
     {
         if (m_localScale != scale && !isLockScale())
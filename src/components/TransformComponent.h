@@ -87,6 +87,9 @@ namespace ige::scene
         //! get world rotation
         virtual const Quat &getRotation() const;
 
+        //! Set world position and rotation with a single matrices update
+        virtual void setWorldTransform(const Vec3& pos, const Quat& rot);
+
         //! Set local scale
         virtual void setLocalScale(const Vec3 &scale);        
 
@@ -1,12 +1,17 @@
 
 #include "AnimatorComponent.h"
 #include "AnimatorController.h"
+#include "AnimatorControllerInstance.h"
 
+#include "components/CameraComponent.h"
 #include "components/FigureComponent.h"
 #include "components/EditableFigureComponent.h"
 
+#include "scene/Scene.h"
 #include "scene/SceneObject.h"
 
+#include "utils/GraphicsHelper.h"
+
 namespace ige::scene
 {
     //! Constructor
@@ -35,19 +40,16 @@ namespace ige::scene
         }
 
         if(figure) {
-            controller = std::make_shared<AnimatorController>();
-            controller->setPath(m_controllerPath);
-            controller->setFigure(figure);
+            controller = AnimatorController::getShared(m_controllerPath);
+            instance = std::make_shared<AnimatorControllerInstance>(controller, figure);
         }
     }
 
     //! Active when stop runtime
     void AnimatorComponent::clear()
     {
-        if(controller) {
-            controller->setFigure(nullptr);
-            controller = nullptr;
-        }
+        instance = nullptr;
+        controller = nullptr;
     }
 
     void AnimatorComponent::setControllerPath(const std::string& path)
@@ -61,20 +63,151 @@ namespace ige::scene
     // Update
     void AnimatorComponent::onUpdate(float dt)
     {
-       if(m_updateMode == UpdateMode::Normal) {
-           if(controller) controller->update(dt);
-       }
-       else if(m_updateMode == UpdateMode::UnscaledTime) {
-           if(controller) controller->update(dt);
-       }
+        // Already updated in the scene animation phase
+        if(m_bAnimationPrepared) {
+            m_bAnimationPrepared = false;
+            return;
+        }
+
+        if(m_updateMode != UpdateMode::AnimatePhysic && instance) {
+            instance->updateBinding();
+            instance->update(dt);
+            dispatchStateEvents();
+        }
+    }
+
+    //! Animation phase: culling, LOD and figure transform sync
+    bool AnimatorComponent::prepareAnimation(float dt)
+    {
+        m_bUpdateController = false;
+        m_stepFigure = nullptr;
+        if(!instance)
+            return false;
+        m_bAnimationPrepared = true;
+
+        // Rebind here, the controller update may run on worker threads
+        instance->updateBinding();
+
+        // The figure is stepped here from now on, its own update only syncs the transform
+        BaseFigure* figure = nullptr;
+        float ratio = 1.f;
+        if(auto figComp = getOwner()->getComponent<FigureComponent>()) {
+            if(figComp->isEnabled() && figComp->getFigure() && figComp->getFigure()->IsInitializeSuccess()) {
+                figComp->syncTransform();
+                figComp->setAnimationStepped();
+                figure = figComp->getFigure();
+                ratio = figComp->getFrameUpdateRatio();
+            }
+        }
+        else if(auto figComp = getOwner()->getComponent<EditableFigureComponent>()) {
+            if(figComp->isEnabled() && figComp->getFigure() && figComp->getFigure()->IsInitializeSuccess()) {
+                figComp->syncTransform();
+                figComp->setAnimationStepped();
+                figure = figComp->getFigure();
+                ratio = figComp->getFrameUpdateRatio();
+            }
+        }
+
+        float controllerDt = dt;
+        float stepDt = dt;
+        bool step = true;
+        if(isCullingActive()) {
+            updateCulling();
+
+            // Culled completely: the time off-screen is dropped
+            if(m_bCulled && m_cullingMode == CullingMode::CullCompletely) {
+                m_controllerDt = m_stepDt = 0.f;
+                m_frameCount = 0;
+                return false;
+            }
+
+            // Far or culled: update every few frames with the accumulated time
+            m_controllerDt += dt;
+            m_stepDt += dt;
+            if(m_bCulled)
+                m_stepDt = std::min(m_stepDt, m_maxCatchUpTime);
+            if(++m_frameCount < m_updateInterval)
+                return false;
+            m_frameCount = 0;
+            controllerDt = m_controllerDt;
+            m_controllerDt = 0.f;
+
+            // Culled update: the figure catches up once visible again
+            step = !m_bCulled;
+            if(step) {
+                stepDt = m_stepDt;
+                m_stepDt = 0.f;
+            }
+        }
+
+        m_bUpdateController = m_updateMode != UpdateMode::AnimatePhysic;
+        m_controllerUpdateDt = controllerDt;
+        if(step && figure) {
+            m_stepFigure = figure;
+            m_figureStepDt = stepDt * ratio;
+        }
+        return m_bUpdateController || m_stepFigure != nullptr;
+    }
+
+    //! Animation phase: controller update and figure step, only touches this animator and its figure
+    void AnimatorComponent::evaluateAnimation()
+    {
+        if(m_bUpdateController) instance->update(m_controllerUpdateDt);
+        if(m_stepFigure) m_stepFigure->Step(m_figureStepDt);
+        m_bUpdateController = false;
+        m_stepFigure = nullptr;
+    }
+
+    //! Animation phase: state events of the controller update
+    void AnimatorComponent::dispatchStateEvents()
+    {
+        // Listeners may reinitialize this animator, keep the instance alive while dispatching
+        if(auto controllerInstance = instance) controllerInstance->dispatchStateEvents();
     }
 
     // Fixed Update
     void AnimatorComponent::onFixedUpdate(float dt)
     {
         if(m_updateMode == UpdateMode::AnimatePhysic) {
-            if(controller) controller->update(dt);
+            if(m_bCulled && m_cullingMode == CullingMode::CullCompletely)
+                return;
+            if(instance) {
+                instance->updateBinding();
+                instance->update(dt);
+                dispatchStateEvents();
+            }
+        }
+    }
+
+    //! Update culling state and update interval from the active camera
+    void AnimatorComponent::updateCulling()
+    {
+        m_bCulled = false;
+        m_updateInterval = 1;
+
+        auto scene = getOwner()->getScene();
+        auto camera = scene ? scene->getActiveCamera() : nullptr;
+        if(!camera)
+            return;
+
+        const auto aabb = getOwner()->getWorldAABB();
+        if(m_cullingMode != CullingMode::AlwaysAnimate) {
+            Mat4 proj, viewInv;
+            camera->getProjectionMatrix(proj);
+            camera->getViewInverseMatrix(viewInv);
+            m_bCulled = !AabbInFrustum(aabb, proj * viewInv.Inverse());
+        }
+
+        if(m_bCulled) {
+            m_updateInterval = m_lodInterval;
+            return;
         }
+
+        const auto distSqr = (aabb.getCenter() - camera->getPosition()).LengthSqr();
+        if(m_lodDistances.Y() > 0.f && distSqr > m_lodDistances.Y() * m_lodDistances.Y())
+            m_updateInterval = m_lodInterval;
+        else if(m_lodDistances.X() > 0.f && distSqr > m_lodDistances.X() * m_lodDistances.X())
+            m_updateInterval = std::min(2, m_lodInterval);
     }
 
         //! Serialize
@@ -83,6 +216,10 @@ namespace ige::scene
         Component::to_json(j);
         j["path"] = getControllerPath();
         j["mode"] = (int)getUpdateMode();
+        j["cullMode"] = (int)getCullingMode();
+        j["lodDist"] = getLodDistances();
+        j["lodInterval"] = getLodInterval();
+        j["maxCatchUp"] = getMaxCatchUpTime();
     }
 
     //! Deserialize
@@ -91,6 +228,10 @@ namespace ige::scene
         Component::from_json(j);
         setControllerPath(j.value("path", std::string()));
         setUpdateMode((UpdateMode)j.value("mode", (int)UpdateMode::Normal));
+        setCullingMode((CullingMode)j.value("cullMode", (int)CullingMode::AlwaysAnimate));
+        setLodDistances(j.value("lodDist", Vec2(0.f, 0.f)));
+        setLodInterval(j.value("lodInterval", 4));
+        setMaxCatchUpTime(j.value("maxCatchUp", 1.f));
     }
 
     //! Update property by key value
@@ -102,6 +243,18 @@ namespace ige::scene
         else if (key.compare("mode") == 0) {
             setUpdateMode((UpdateMode)((int)val));
         }
+        else if (key.compare("cullMode") == 0) {
+            setCullingMode((CullingMode)((int)val));
+        }
+        else if (key.compare("lodDist") == 0) {
+            setLodDistances(val);
+        }
+        else if (key.compare("lodInterval") == 0) {
+            setLodInterval(val);
+        }
+        else if (key.compare("maxCatchUp") == 0) {
+            setMaxCatchUpTime(val);
+        }
         else {
             Component::setProperty(key, val);
         }
@@ -3,9 +3,15 @@
 #include "components/Component.h"
 #include "event/Event.h"
 
+#include "utils/PyxieHeaders.h"
+using namespace pyxie;
+
+#include <algorithm>
+
 namespace ige::scene
 {
     class AnimatorController;
+    class AnimatorControllerInstance;
 
     /**
      * Class Animator
@@ -19,6 +25,12 @@ namespace ige::scene
             UnscaledTime, // sync with onUpdate, but ignore timeScale factor
         };
 
+        enum class CullingMode {
+            AlwaysAnimate = 0, // update and step the figure even when off-screen
+            CullUpdate, // off-screen: update the controller at low rate, step the figure when visible again
+            CullCompletely, // off-screen: no update at all
+        };
+
         AnimatorComponent(SceneObject& owner);
         virtual ~AnimatorComponent();
 
@@ -38,14 +50,46 @@ namespace ige::scene
         const std::string& getControllerPath() const { return m_controllerPath; }
         void setControllerPath(const std::string& path);
 
-        //! Controller
+        //! Controller, shared by all animators using the same controller path
         std::shared_ptr<AnimatorController> getController() { return controller; }
         void setController(const std::shared_ptr<AnimatorController>& controller);
 
+        //! Controller instance: states, timers and parameters of this animator
+        std::shared_ptr<AnimatorControllerInstance> getInstance() { return instance; }
+
         //! Update mode
         UpdateMode getUpdateMode() const { return m_updateMode; }
         void setUpdateMode(UpdateMode mode) { m_updateMode = mode; }
 
+        //! Culling mode, visibility is tested with the owner world AABB and the active camera
+        CullingMode getCullingMode() const { return m_cullingMode; }
+        void setCullingMode(CullingMode mode) { m_cullingMode = mode; }
+
+        //! Camera distances beyond which the animation updates every 2nd frame and every lodInterval frames, 0 to disable
+        const Vec2& getLodDistances() const { return m_lodDistances; }
+        void setLodDistances(const Vec2& distances) { m_lodDistances = distances; }
+
+        //! Update interval of far and culled animations, in frames
+        int getLodInterval() const { return m_lodInterval; }
+        void setLodInterval(int interval) { m_lodInterval = std::max(interval, 1); }
+
+        //! Off-screen time the figure catches up with CullUpdate once visible again, in seconds. Longer time is dropped.
+        float getMaxCatchUpTime() const { return m_maxCatchUpTime; }
+        void setMaxCatchUpTime(float time) { m_maxCatchUpTime = std::max(time, 0.f); }
+
+        //! Visible in the last update
+        bool isVisible() const { return !m_bCulled; }
+
+        //! Animation phase, run by the scene before components update.
+        //! Decides culling and LOD and syncs the figure transform, returns whether evaluateAnimation() has work.
+        bool prepareAnimation(float dt);
+
+        //! Animation phase: update the controller and step the figure. Animators of different objects may run in parallel.
+        void evaluateAnimation();
+
+        //! Animation phase: invoke the state events queued by evaluateAnimation(), on the main thread
+        void dispatchStateEvents();
+
         //! Override update functions
         virtual void onUpdate(float dt) override;
 
@@ -61,14 +105,50 @@ namespace ige::scene
         //! Update property by key value
         virtual void setProperty(const std::string& key, const json& val) override;
 
+    protected:
+        //! Update culling state and update interval from the active camera
+        void updateCulling();
+
+        //! Culling and LOD active, otherwise the figure steps every frame
+        bool isCullingActive() const { return m_cullingMode != CullingMode::AlwaysAnimate || m_lodDistances.X() > 0.f || m_lodDistances.Y() > 0.f; }
+
     public:
-        //! Animator controller instance
+        //! Shared animator controller
         std::shared_ptr<AnimatorController> controller = nullptr;
 
+        //! Animator controller instance
+        std::shared_ptr<AnimatorControllerInstance> instance = nullptr;
+
         //! Update mode
         UpdateMode m_updateMode = UpdateMode::Normal;
 
         //! Controller path
         std::string m_controllerPath = {};
+
+        //! Culling mode
+        CullingMode m_cullingMode = CullingMode::AlwaysAnimate;
+
+        //! LOD distances and interval
+        Vec2 m_lodDistances = {0.f, 0.f};
+        int m_lodInterval = 4;
+
+        //! Bound of the figure catch-up after CullUpdate
+        float m_maxCatchUpTime = 1.f;
+
+        //! Culling state
+        bool m_bCulled = false;
+        int m_updateInterval = 1;
+        int m_frameCount = 0;
+
+        //! Time accumulated for the controller and the figure between updates
+        float m_controllerDt = 0.f;
+        float m_stepDt = 0.f;
+
+        //! Work decided by prepareAnimation()
+        bool m_bAnimationPrepared = false;
+        bool m_bUpdateController = false;
+        float m_controllerUpdateDt = 0.f;
+        BaseFigure* m_stepFigure = nullptr;
+        float m_figureStepDt = 0.f;
     };
 } // namespace ige::scene
@@ -1,14 +1,20 @@
 #include "AnimatorController.h"
 #include "AnimatorStateMachine.h"
+#include "AnimatorTransition.h"
 
 #include "utils/filesystem.h"
 namespace fs = ghc::filesystem;
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 
 namespace ige::scene
 {    
+    //! Initialize static members
+    std::unordered_map<std::string, std::weak_ptr<AnimatorController>> AnimatorController::m_cache;
+    std::mutex AnimatorController::m_cacheMutex;
+
     //! Constructor
     AnimatorController::AnimatorController()
     {
@@ -22,6 +28,33 @@ namespace ige::scene
         clear();
     }
 
+    //! Shared controller loaded from path
+    std::shared_ptr<AnimatorController> AnimatorController::getShared(const std::string& path)
+    {
+        auto fsPath = fs::path(path);
+        auto relPath = fsPath.is_absolute() ? fs::relative(fs::path(path)).string() : fsPath.string();
+        if (relPath.size() == 0) relPath = fsPath.string();
+        std::replace(relPath.begin(), relPath.end(), '\\', '/');
+
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        auto itr = m_cache.find(relPath);
+        if (itr != m_cache.end() && !itr->second.expired())
+            return itr->second.lock();
+
+        auto controller = std::make_shared<AnimatorController>();
+        controller->setPath(relPath);
+        controller->compile();
+        if (!relPath.empty())
+            m_cache[relPath] = controller;
+        return controller;
+    }
+
+    void AnimatorController::clearCache()
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        m_cache.clear();
+    }
+
     void AnimatorController::initialize()
     {
         clear();
@@ -44,6 +77,88 @@ namespace ige::scene
     {
         m_stateMachines.clear();
         m_figure = nullptr;
+        m_compiled = nullptr;
+        ++m_compileVersion;
+    }
+
+    //! Compile state machines to flat tables
+    void AnimatorController::compile()
+    {
+        auto data = std::make_shared<AnimatorCompiledData>();
+        auto addSlot = [&data](const std::string& param) {
+            auto itr = data->parameterSlots.find(param);
+            if (itr != data->parameterSlots.end())
+                return itr->second;
+            auto slot = (int)data->parameterNames.size();
+            data->parameterNames.push_back(param);
+            data->parameterSlots[param] = slot;
+            return slot;
+        };
+
+        // Sorted, so slots do not depend on the hash map order
+        std::vector<std::string> declared;
+        for (const auto& [name, param] : m_parameters)
+            declared.push_back(name);
+        std::sort(declared.begin(), declared.end());
+        for (const auto& name : declared)
+            addSlot(name);
+
+        for (const auto& sm : m_stateMachines) {
+            AnimatorCompiledLayer compiled;
+            if (sm) {
+                compiled.layer = sm->getLayer();
+                compiled.states = sm->getStates();
+
+                auto findIndex = [&](const std::shared_ptr<AnimatorState>& state) {
+                    auto itr = std::find(compiled.states.begin(), compiled.states.end(), state);
+                    return (itr != compiled.states.end()) ? (int)(itr - compiled.states.begin()) : -1;
+                };
+                compiled.enterState = findIndex(sm->getEnterState());
+                compiled.anyState = findIndex(sm->getAnyState());
+
+                for (const auto& state : compiled.states) {
+                    AnimatorCompiledState compiledState;
+                    compiledState.firstTransition = (uint32_t)compiled.transitions.size();
+                    compiledState.isExit = state->isExit();
+
+                    // Muted transitions and transitions without destination never fire
+                    for (const auto& transition : state->transitions) {
+                        auto destState = transition->destState.lock();
+                        auto destIdx = findIndex(destState);
+                        if (transition->isMute || destIdx < 0)
+                            continue;
+
+                        AnimatorCompiledTransition compiledTransition;
+                        compiledTransition.destState = destIdx;
+                        compiledTransition.firstCondition = (uint32_t)compiled.conditions.size();
+                        compiledTransition.numConditions = (uint32_t)transition->conditions.size();
+                        compiledTransition.hasExitTime = transition->hasExitTime;
+                        compiledTransition.hasFixedDuration = transition->hasFixedDuration;
+                        compiledTransition.exitTime = transition->exitTime;
+                        compiledTransition.duration = transition->duration;
+                        compiledTransition.offset = transition->offset;
+                        for (const auto& condition : transition->conditions)
+                            compiled.conditions.push_back({ addSlot(condition->parameter), condition->mode, condition->threshold });
+                        compiled.transitions.push_back(compiledTransition);
+                    }
+                    compiledState.numTransitions = (uint32_t)compiled.transitions.size() - compiledState.firstTransition;
+                    compiled.stateTable.push_back(compiledState);
+                }
+            }
+            data->layers.push_back(std::move(compiled));
+        }
+
+        // Running instances keep the previous tables until they rebind
+        m_compiled = data;
+        ++m_compileVersion;
+    }
+
+    int AnimatorController::getParameterSlot(const std::string& param) const
+    {
+        if (!m_compiled)
+            return -1;
+        auto itr = m_compiled->parameterSlots.find(param);
+        return (itr != m_compiled->parameterSlots.end()) ? itr->second : -1;
     }
 
     bool AnimatorController::addLayer()
@@ -103,6 +218,12 @@ namespace ige::scene
             m_path = relPath;
         }
 
+        // Controllers shared by figures were loaded from the old content
+        {
+            std::lock_guard<std::mutex> lock(m_cacheMutex);
+            m_cache.erase(m_path);
+        }
+
         json jScene;
         to_json(jScene);
         fs::create_directories(fsPath.parent_path());
@@ -9,9 +9,62 @@
 #include "core/Object.h"
 using namespace pyxie;
 
+#include <mutex>
+#include <unordered_map>
+
 namespace ige::scene
 {    
     class AnimatorStateMachine;
+    class AnimatorState;
+
+    //! Compiled condition, the parameter is resolved to a slot
+    struct AnimatorCompiledCondition
+    {
+        int parameter = -1;
+        AnimatorCondition::Mode mode = AnimatorCondition::Mode::Equal;
+        float threshold = 0.f;
+    };
+
+    //! Compiled transition, conditions are a range of the layer condition table
+    struct AnimatorCompiledTransition
+    {
+        int destState = -1;
+        uint32_t firstCondition = 0;
+        uint32_t numConditions = 0;
+        bool hasExitTime = false;
+        bool hasFixedDuration = false;
+        float exitTime = 1.f;
+        float duration = 0.f;
+        float offset = 0.f;
+    };
+
+    //! Compiled state, transitions are a range of the layer transition table
+    struct AnimatorCompiledState
+    {
+        uint32_t firstTransition = 0;
+        uint32_t numTransitions = 0;
+        bool isExit = false;
+    };
+
+    //! Compiled state machine layer: flat state, transition and condition tables
+    struct AnimatorCompiledLayer
+    {
+        int layer = -1;
+        int enterState = -1;
+        int anyState = -1;
+        std::vector<std::shared_ptr<AnimatorState>> states;
+        std::vector<AnimatorCompiledState> stateTable;
+        std::vector<AnimatorCompiledTransition> transitions;
+        std::vector<AnimatorCompiledCondition> conditions;
+    };
+
+    //! Compiled tables of a controller, replaced as a whole by compile() so instances keep the tables they were bound to
+    struct AnimatorCompiledData
+    {
+        std::vector<AnimatorCompiledLayer> layers;
+        std::vector<std::string> parameterNames;
+        std::unordered_map<std::string, int> parameterSlots;
+    };
 
     /**
      * Class AnimatorController
@@ -22,6 +75,10 @@ namespace ige::scene
         AnimatorController();
         virtual ~AnimatorController();
 
+        //! Shared controller loaded from path, kept while in use. Treat it as read-only, per-figure state lives in AnimatorControllerInstance
+        static std::shared_ptr<AnimatorController> getShared(const std::string& path);
+        static void clearCache();
+
         //! Object Type
         std::string getType() const override { return "AnimatorController"; }
 
@@ -69,6 +126,17 @@ namespace ige::scene
         virtual void restore_from_json(const json& j);
         
 
+        //! Compile state machines to flat tables, parameters are resolved to slots
+        void compile();
+        bool isCompiled() const { return m_compiled != nullptr; }
+        const std::shared_ptr<const AnimatorCompiledData>& getCompiledData() const { return m_compiled; }
+
+        //! Increased by every compile() and clear(), instances rebind when it changed
+        uint32_t getCompileVersion() const { return m_compileVersion; }
+
+        //! Parameter slots: declared parameters first, then parameters only used by conditions
+        int getParameterSlot(const std::string& param) const;
+
         //! State machine
         std::vector<std::shared_ptr<AnimatorStateMachine>>& getStateMachines() { return m_stateMachines; }
         std::shared_ptr<AnimatorStateMachine> getStateMachine(int layer = 0);
@@ -89,5 +157,13 @@ namespace ige::scene
         BaseFigure* m_figure = nullptr;
         std::unordered_map<std::string, std::pair<AnimatorParameterType, float>> m_parameters;
         bool m_dirty = false;
+
+        //! Compiled tables
+        std::shared_ptr<const AnimatorCompiledData> m_compiled;
+        uint32_t m_compileVersion = 0;
+
+        //! Shared controllers by path
+        static std::unordered_map<std::string, std::weak_ptr<AnimatorController>> m_cache;
+        static std::mutex m_cacheMutex;
     };
 } // namespace ige::scene
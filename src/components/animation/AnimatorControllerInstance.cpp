@@ -0,0 +1,395 @@
+#include "AnimatorControllerInstance.h"
+#include "AnimatorController.h"
+#include "AnimatorState.h"
+
+#include <algorithm>
+
+namespace ige::scene
+{
+    AnimatorControllerInstance::AnimatorControllerInstance(const std::shared_ptr<AnimatorController>& controller, BaseFigure* figure)
+        : m_controller(controller), m_figure(figure)
+    {
+        if (m_controller) {
+            m_timeScale = m_controller->getTimeScale();
+            bind();
+        }
+    }
+
+    AnimatorControllerInstance::~AnimatorControllerInstance()
+    {
+        for (auto& layer : m_layers) {
+            for (auto animator : layer.animators) {
+                if (animator) animator->DecReference();
+            }
+            layer.animators.clear();
+        }
+        m_layers.clear();
+        m_figure = nullptr;
+        m_controller = nullptr;
+    }
+
+    //! Bind to the compiled tables of the controller
+    void AnimatorControllerInstance::bind()
+    {
+        if (!m_controller->isCompiled())
+            m_controller->compile();
+        auto compiled = m_controller->getCompiledData();
+        m_compileVersion = m_controller->getCompileVersion();
+
+        // Parameter values move to their new slots, parameters no transition reads anymore become extra parameters
+        std::vector<Parameter> parameters(compiled->parameterNames.size());
+        for (int i = 0; i < parameters.size(); ++i) {
+            const auto& name = compiled->parameterNames[i];
+            auto slot = getParameterSlot(name);
+            auto extra = m_extraParameters.find(name);
+            if (slot >= 0 && m_parameters[slot].isSet) {
+                parameters[i] = m_parameters[slot];
+            }
+            else if (extra != m_extraParameters.end()) {
+                parameters[i] = { extra->second.first, extra->second.second, true };
+            }
+            else if (m_controller->hasParameter(name)) {
+                auto [type, value] = m_controller->getParameter(name);
+                parameters[i] = { type, value, true };
+            }
+            if (extra != m_extraParameters.end())
+                m_extraParameters.erase(extra);
+        }
+        if (m_compiled) {
+            for (int i = 0; i < m_parameters.size(); ++i) {
+                const auto& name = m_compiled->parameterNames[i];
+                if (m_parameters[i].isSet && compiled->parameterSlots.count(name) == 0)
+                    m_extraParameters[name] = { m_parameters[i].type, m_parameters[i].value };
+            }
+        }
+        m_parameters = std::move(parameters);
+
+        // Current states and clips carry over by state, new clips are created up front since the update may run on worker threads
+        bool rebind = !m_layers.empty();
+        std::vector<Layer> layers;
+        for (const auto& compiledLayer : compiled->layers) {
+            Layer layer;
+            layer.compiled = &compiledLayer;
+            layer.currentState = compiledLayer.enterState;
+
+            auto oldLayer = std::find_if(m_layers.begin(), m_layers.end(), [&](const auto& elem) { return elem.compiled->layer == compiledLayer.layer; });
+            layer.animators.resize(compiledLayer.states.size(), nullptr);
+            for (int i = 0; i < compiledLayer.states.size(); ++i) {
+                const auto& state = compiledLayer.states[i];
+                if (oldLayer != m_layers.end()) {
+                    const auto& oldStates = oldLayer->compiled->states;
+                    auto oldIdx = (int)(std::find(oldStates.begin(), oldStates.end(), state) - oldStates.begin());
+                    if (oldIdx < oldStates.size()) {
+                        layer.animators[i] = oldLayer->animators[oldIdx];
+                        if (layer.animators[i]) layer.animators[i]->IncReference();
+                        if (oldIdx == oldLayer->currentState) layer.currentState = i;
+                        continue;
+                    }
+                }
+                const auto& path = state->getPath();
+                if (path.empty())
+                    continue;
+                auto animator = (Animator*)ResourceCreator::Instance().NewAnimator(path.c_str());
+                if (animator) animator->WaitInitialize();
+                layer.animators[i] = animator;
+            }
+            layers.push_back(std::move(layer));
+        }
+        for (auto& layer : m_layers) {
+            for (auto animator : layer.animators) {
+                if (animator) animator->DecReference();
+            }
+        }
+        m_layers = std::move(layers);
+        m_compiled = compiled;
+
+        // An exit and an enter event per state change, reserved so the evaluation does not allocate
+        size_t numStates = 0;
+        for (const auto& layer : m_layers)
+            numStates += layer.compiled->states.size();
+        m_pendingStateEvents.reserve(numStates * 2);
+
+        // Running transitions are dropped, figures play the current states again
+        if (rebind && m_figure) {
+            for (auto& layer : m_layers) {
+                auto slot = layer.compiled->layer;
+                if (slot < 0 || slot > 3)
+                    continue;
+                m_figure->BindAnimator((BaseFigure::AnimatorSlot)(slot * 2 + 1), getAnimator(layer, layer.currentState));
+                m_figure->BindAnimator((BaseFigure::AnimatorSlot)(slot * 2 + 2), (Animator*)nullptr);
+            }
+        }
+    }
+
+    //! Rebind to the controller tables if it recompiled
+    void AnimatorControllerInstance::updateBinding()
+    {
+        if (m_controller && m_controller->getCompileVersion() != m_compileVersion)
+            bind();
+    }
+
+    //! Parameter slot in the bound tables
+    int AnimatorControllerInstance::getParameterSlot(const std::string& param) const
+    {
+        if (!m_compiled)
+            return -1;
+        auto itr = m_compiled->parameterSlots.find(param);
+        return (itr != m_compiled->parameterSlots.end()) ? itr->second : -1;
+    }
+
+    //! Parameters by name
+    void AnimatorControllerInstance::setParameter(const std::string& param, int type, float value)
+    {
+        auto slot = getParameterSlot(param);
+        if (slot >= 0) {
+            setParameter(slot, type, value);
+            return;
+        }
+        type = std::clamp(type, (int)AnimatorParameterType::Bool, (int)AnimatorParameterType::Trigger);
+        m_extraParameters[param] = {(AnimatorParameterType)type, value};
+    }
+
+    std::pair<AnimatorParameterType, float> AnimatorControllerInstance::getParameter(const std::string& param) const
+    {
+        auto slot = getParameterSlot(param);
+        if (slot >= 0)
+            return getParameter(slot);
+        auto itr = m_extraParameters.find(param);
+        return (itr != m_extraParameters.end()) ? itr->second : std::make_pair<AnimatorParameterType, float>(AnimatorParameterType::Float, 0.f);
+    }
+
+    bool AnimatorControllerInstance::hasParameter(const std::string& param) const
+    {
+        auto slot = getParameterSlot(param);
+        if (slot >= 0)
+            return m_parameters[slot].isSet;
+        return m_extraParameters.count(param) > 0;
+    }
+
+    size_t AnimatorControllerInstance::getParameterCount() const
+    {
+        auto count = m_extraParameters.size();
+        for (const auto& param : m_parameters)
+            if (param.isSet) ++count;
+        return count;
+    }
+
+    //! Parameters by slot
+    void AnimatorControllerInstance::setParameter(int slot, int type, float value)
+    {
+        if (slot < 0 || slot >= m_parameters.size())
+            return;
+        type = std::clamp(type, (int)AnimatorParameterType::Bool, (int)AnimatorParameterType::Trigger);
+        m_parameters[slot] = { (AnimatorParameterType)type, value, true };
+    }
+
+    std::pair<AnimatorParameterType, float> AnimatorControllerInstance::getParameter(int slot) const
+    {
+        if (slot < 0 || slot >= m_parameters.size() || !m_parameters[slot].isSet)
+            return std::make_pair<AnimatorParameterType, float>(AnimatorParameterType::Float, 0.f);
+        return { m_parameters[slot].type, m_parameters[slot].value };
+    }
+
+    //! States
+    int AnimatorControllerInstance::findState(const Layer& layer, const std::string& name) const
+    {
+        const auto& states = layer.compiled->states;
+        auto itr = std::find_if(states.begin(), states.end(), [&](const auto& elem) {
+            return elem->getUUID().compare(name) == 0;
+        });
+        if (itr == states.end()) {
+            itr = std::find_if(states.begin(), states.end(), [&](const auto& elem) {
+                return elem->getName().compare(name) == 0;
+            });
+        }
+        return (itr != states.end()) ? (int)(itr - states.begin()) : -1;
+    }
+
+    bool AnimatorControllerInstance::hasState(const std::string& name, int layer) const
+    {
+        if (layer < 0 || layer >= m_layers.size())
+            return false;
+        return findState(m_layers[layer], name) >= 0;
+    }
+
+    std::shared_ptr<AnimatorState> AnimatorControllerInstance::getCurrentState(int layer) const
+    {
+        if (layer < 0 || layer >= m_layers.size() || m_layers[layer].currentState < 0)
+            return nullptr;
+        return m_layers[layer].compiled->states[m_layers[layer].currentState];
+    }
+
+    bool AnimatorControllerInstance::play(const std::string& state, int layer)
+    {
+        if (layer < 0 || layer >= m_layers.size())
+            return false;
+
+        auto stateIdx = findState(m_layers[layer], state);
+        if (stateIdx < 0)
+            return false;
+
+        setCurrentState(m_layers[layer], stateIdx);
+        dispatchStateEvents();
+        return true;
+    }
+
+    //! Invoke the queued state events
+    void AnimatorControllerInstance::dispatchStateEvents()
+    {
+        if (m_bDispatchingStateEvents || m_pendingStateEvents.empty())
+            return;
+
+        // Listeners may play another state, its events are appended and dispatched by this loop
+        m_bDispatchingStateEvents = true;
+        for (size_t i = 0; i < m_pendingStateEvents.size(); ++i) {
+            auto event = m_pendingStateEvents[i];
+            if (event.isEnter)
+                m_onStateEnterEvent.invoke(*event.state);
+            else
+                m_onStateExitEvent.invoke(*event.state);
+        }
+        m_pendingStateEvents.clear();
+        m_bDispatchingStateEvents = false;
+    }
+
+    //! Motion clip of this instance for the state
+    Animator* AnimatorControllerInstance::getAnimator(Layer& layer, int state)
+    {
+        return (state >= 0 && state < layer.animators.size()) ? layer.animators[state] : nullptr;
+    }
+
+    void AnimatorControllerInstance::setCurrentState(Layer& layer, int state)
+    {
+        if (layer.currentState != state) {
+            const auto& states = layer.compiled->states;
+            if (layer.currentState >= 0) m_pendingStateEvents.push_back({ states[layer.currentState], false });
+            layer.currentState = state;
+            auto animator = getAnimator(layer, state);
+            if (state >= 0) {
+                states[state]->setupAnimator(animator);
+                m_pendingStateEvents.push_back({ states[state], true });
+            }
+            if (m_figure) {
+                auto slot = layer.compiled->layer;
+                m_figure->BindAnimator((BaseFigure::AnimatorSlot)(slot * 2 + 1), animator);
+                m_figure->BindAnimator((BaseFigure::AnimatorSlot)(slot * 2 + 2), (Animator*)nullptr);
+            }
+        }
+        layer.transitionTime = layer.transitionDuration = 0.f;
+        layer.nextState = -1;
+    }
+
+    //! Update
+    void AnimatorControllerInstance::update(float dt)
+    {
+        if (!m_figure) return;
+        for (auto& layer : m_layers)
+            updateLayer(layer, dt * m_timeScale);
+    }
+
+    void AnimatorControllerInstance::updateLayer(Layer& layer, float dt)
+    {
+        const auto& compiled = *layer.compiled;
+
+        // Layer A, B, C only, otherwise return
+        if (compiled.layer < 0 || compiled.layer > 3)
+            return;
+
+        if (layer.currentState < 0)
+            return;
+
+        // Exit state
+        if (compiled.stateTable[layer.currentState].isExit) {
+            layer.currentState = -1;
+            return;
+        }
+
+        auto animator = getAnimator(layer, layer.currentState);
+
+        // Update transition blending
+        if (layer.nextState >= 0 && layer.currentState != layer.nextState) {
+            if (layer.transitionDuration <= 0.f || layer.transitionTime >= layer.transitionDuration) {
+                setCurrentState(layer, layer.nextState);
+                return;
+            }
+            layer.transitionTime += dt;
+            if (layer.transitionTime > layer.transitionDuration) layer.transitionTime = layer.transitionDuration;
+            m_figure->SetBlendingWeight(compiled.layer, layer.transitionTime / layer.transitionDuration);
+            return;
+        }
+
+        // Update transitions, which are from current state and Any state
+        const AnimatorCompiledTransition* activeTransition = nullptr;
+        for (auto stateIdx : { layer.currentState, compiled.anyState }) {
+            if (stateIdx < 0 || activeTransition)
+                continue;
+            const auto& state = compiled.stateTable[stateIdx];
+            for (uint32_t i = state.firstTransition; i < state.firstTransition + state.numTransitions; ++i) {
+                if (checkTransition(layer, compiled.transitions[i], animator)) {
+                    activeTransition = &compiled.transitions[i];
+                    break;
+                }
+            }
+        }
+
+        if (activeTransition) {
+            layer.nextState = activeTransition->destState;
+            if (layer.nextState != layer.currentState) {
+                auto nextAnimator = getAnimator(layer, layer.nextState);
+                layer.transitionTime = 0.f;
+                layer.transitionDuration = activeTransition->offset + (activeTransition->hasExitTime ? activeTransition->hasFixedDuration ? activeTransition->duration : activeTransition->exitTime * (nextAnimator ? nextAnimator->GetEndTime() : 0.f) : 0.f);
+                if (layer.transitionDuration > 0.f) {
+                    m_figure->BindAnimator((BaseFigure::AnimatorSlot)(compiled.layer * 2 + 2), nextAnimator);
+                }
+                else {
+                    setCurrentState(layer, layer.nextState);
+                }
+            }
+        }
+    }
+
+    bool AnimatorControllerInstance::checkTransition(const Layer& layer, const AnimatorCompiledTransition& transition, Animator* animator)
+    {
+        if (transition.numConditions == 0)
+            return true;
+
+        // Transition with exit time go first
+        if (animator && transition.hasExitTime) {
+            if (transition.hasFixedDuration) {
+                if (animator->GetEvalTime() > transition.exitTime)
+                    return true;
+            }
+            else if (animator->GetEvalTime() / animator->GetEndTime() > transition.exitTime) {
+                return true;
+            }
+        }
+
+        // Check conditions, parameters which are not set are skipped
+        const auto& conditions = layer.compiled->conditions;
+        for (uint32_t i = transition.firstCondition; i < transition.firstCondition + transition.numConditions; ++i) {
+            const auto& condition = conditions[i];
+            auto& param = m_parameters[condition.parameter];
+            if (!param.isSet)
+                continue;
+
+            auto value = param.value;
+            if (!((condition.mode == AnimatorCondition::Mode::If && value != 0.f)
+                || (condition.mode == AnimatorCondition::Mode::IfNot && value == 0.f)
+                || (condition.mode == AnimatorCondition::Mode::Equal && value == condition.threshold)
+                || (condition.mode == AnimatorCondition::Mode::NotEqual && value != condition.threshold)
+                || (condition.mode == AnimatorCondition::Mode::Greater && value > condition.threshold)
+                || (condition.mode == AnimatorCondition::Mode::GreaterOrEqual && value >= condition.threshold)
+                || (condition.mode == AnimatorCondition::Mode::Less && value < condition.threshold)
+                || (condition.mode == AnimatorCondition::Mode::LessOrEqual && value <= condition.threshold)
+                )) {
+                return false;
+            }
+
+            // Reset trigger state
+            if (param.type == AnimatorParameterType::Trigger) {
+                param.value = 0.f;
+            }
+        }
+        return true;
+    }
+} // namespace ige::scene
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "AnimatorCondition.h"
+#include "event/Event.h"
+
+#include "utils/PyxieHeaders.h"
+using namespace pyxie;
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ige::scene
+{
+    class AnimatorController;
+    class AnimatorState;
+    struct AnimatorCompiledLayer;
+    struct AnimatorCompiledData;
+    struct AnimatorCompiledTransition;
+
+    /**
+     * Class AnimatorControllerInstance: per-figure runtime of a shared, read-only AnimatorController.
+     * Holds the current states, transition timers, parameter values and motion clips of one character.
+     * Transitions are evaluated on the compiled tables of the controller, parameters are stored by slot.
+     */
+    class AnimatorControllerInstance
+    {
+    public:
+        AnimatorControllerInstance(const std::shared_ptr<AnimatorController>& controller, BaseFigure* figure);
+        virtual ~AnimatorControllerInstance();
+
+        //! Shared controller asset
+        const std::shared_ptr<AnimatorController>& getController() const { return m_controller; }
+
+        //! Figure
+        BaseFigure* getFigure() { return m_figure; }
+
+        //! TimeScale
+        float getTimeScale() const { return m_timeScale; }
+        void setTimeScale(float ts) { m_timeScale = ts; }
+
+        //! Parameters by name, initialized from the controller defaults
+        void setParameter(const std::string& param, int type, float value);
+        std::pair<AnimatorParameterType, float> getParameter(const std::string& param) const;
+        bool hasParameter(const std::string& param) const;
+        size_t getParameterCount() const;
+
+        //! Parameters by slot, see AnimatorController::getParameterSlot()
+        void setParameter(int slot, int type, float value);
+        std::pair<AnimatorParameterType, float> getParameter(int slot) const;
+
+        //! States
+        bool hasState(const std::string& name, int layer = 0) const;
+        std::shared_ptr<AnimatorState> getCurrentState(int layer = 0) const;
+
+        //! Switch to the state with given name or uuid, state events are dispatched right away
+        bool play(const std::string& state, int layer = 0);
+
+        //! Update, state changes are queued until dispatchStateEvents()
+        virtual void update(float dt);
+
+        //! State events of this instance. The shared AnimatorState events are not invoked at runtime.
+        Event<AnimatorState&>& getOnStateEnterEvent() { return m_onStateEnterEvent; }
+        Event<AnimatorState&>& getOnStateExitEvent() { return m_onStateExitEvent; }
+
+        //! Invoke the queued state events, call from the main thread
+        void dispatchStateEvents();
+
+        //! Rebind to the controller tables if it recompiled, parameter values and current states carry over. Call from the main thread.
+        void updateBinding();
+
+    protected:
+        struct Parameter
+        {
+            AnimatorParameterType type = AnimatorParameterType::Float;
+            float value = 0.f;
+            bool isSet = false;
+        };
+
+        struct Layer
+        {
+            const AnimatorCompiledLayer* compiled = nullptr;
+            int currentState = -1;
+            int nextState = -1;
+            float transitionTime = 0.f;
+            float transitionDuration = 0.f;
+
+            //! Motion clips of this instance by state index, created with the instance
+            std::vector<Animator*> animators;
+        };
+
+        //! State change waiting for dispatchStateEvents()
+        struct StateEvent
+        {
+            std::shared_ptr<AnimatorState> state;
+            bool isEnter = false;
+        };
+
+        //! Bind to the compiled tables of the controller
+        void bind();
+
+        //! Parameter slot in the bound tables
+        int getParameterSlot(const std::string& param) const;
+
+        //! Motion clip of this instance for the state
+        Animator* getAnimator(Layer& layer, int state);
+
+        int findState(const Layer& layer, const std::string& name) const;
+        void setCurrentState(Layer& layer, int state);
+        void updateLayer(Layer& layer, float dt);
+        bool checkTransition(const Layer& layer, const AnimatorCompiledTransition& transition, Animator* animator);
+
+    protected:
+        std::shared_ptr<AnimatorController> m_controller = nullptr;
+        BaseFigure* m_figure = nullptr;
+        float m_timeScale = 1.f;
+
+        //! Bound compiled tables, layers point into them
+        std::shared_ptr<const AnimatorCompiledData> m_compiled;
+        uint32_t m_compileVersion = 0;
+
+        //! Parameter values by slot
+        std::vector<Parameter> m_parameters;
+
+        //! Parameters unknown to the controller, no transition reads them
+        std::unordered_map<std::string, std::pair<AnimatorParameterType, float>> m_extraParameters;
+
+        std::vector<Layer> m_layers;
+
+        //! State events, queued since update() may run on worker threads
+        std::vector<StateEvent> m_pendingStateEvents;
+        bool m_bDispatchingStateEvents = false;
+        Event<AnimatorState&> m_onStateEnterEvent;
+        Event<AnimatorState&> m_onStateExitEvent;
+    };
+} // namespace ige::scene
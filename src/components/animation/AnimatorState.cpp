@@ -21,16 +21,21 @@ namespace ige::scene {
 
     void AnimatorState::enter()
     {
-        if (m_animator) {
-            m_animator->SetSpeed(m_speed);
-            m_animator->SetStartTime(m_startTime);
-            m_animator->SetEvalTime(m_evalTime);
-            m_animator->SetLoop(m_isLoop);
-            m_animator->Rewind();
-        }
+        setupAnimator(m_animator);
         getOnEnterEvent().invoke(*this);
     }
 
+    void AnimatorState::setupAnimator(Animator* animator) const
+    {
+        if (animator) {
+            animator->SetSpeed(m_speed);
+            animator->SetStartTime(m_startTime);
+            animator->SetEvalTime(m_evalTime);
+            animator->SetLoop(m_isLoop);
+            animator->Rewind();
+        }
+    }
+
     void AnimatorState::exit()
     {
         getOnExitEvent().invoke(*this);
@@ -72,6 +72,9 @@ namespace ige::scene
         //! Enter
         virtual void enter();
 
+        //! Apply speed, timing and loop settings to a motion clip owned by a controller instance, no event is invoked
+        virtual void setupAnimator(Animator* animator) const;
+
         //! Exit
         virtual void exit();
 
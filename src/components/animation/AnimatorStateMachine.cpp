@@ -178,55 +178,56 @@ namespace ige::scene {
             
             // Update transitions, which are from current state and Any state
             std::shared_ptr<AnimatorTransition> activeTransition = nullptr;
-            auto transitions = currentState->transitions;
-            transitions.insert(transitions.end(), anyState->transitions.begin(), anyState->transitions.end());
-            for (auto& transition : transitions) {
-                if (!transition->destState.expired() && !transition->isMute) {
-                    if (transition->conditions.empty()) {
-                        activeTransition = transition;
-                        break;
-                    }
+            for (auto transitions : { &currentState->transitions, &anyState->transitions }) {
+                if (activeTransition) break;
+                for (auto& transition : *transitions) {
+                    if (!transition->destState.expired() && !transition->isMute) {
+                        if (transition->conditions.empty()) {
+                            activeTransition = transition;
+                            break;
+                        }
 
-                    // Transition with exit time go first
-                    if (animator && transition->hasExitTime) {
-                        if (transition->hasFixedDuration) {
-                            if (animator->GetEvalTime() > transition->exitTime) {
+                        // Transition with exit time go first
+                        if (animator && transition->hasExitTime) {
+                            if (transition->hasFixedDuration) {
+                                if (animator->GetEvalTime() > transition->exitTime) {
+                                    activeTransition = transition;
+                                    break;
+                                }
+                            }
+                            else if (animator->GetEvalTime() / animator->GetEndTime() > transition->exitTime) {
                                 activeTransition = transition;
                                 break;
                             }
                         }
-                        else if (animator->GetEvalTime() / animator->GetEndTime() > transition->exitTime) {
-                            activeTransition = transition;
-                            break;
-                        }
-                    }
 
-                    // Check conditions
-                    bool shouldActiveTransition = true;
-                    for (auto& condition : transition->conditions) {
-                        if (getController()->hasParameter(condition->parameter)) {
-                            auto [type, value] = getController()->getParameter(condition->parameter);
-                            if (!((condition->mode == AnimatorCondition::Mode::If && value != 0.f)
-                                || (condition->mode == AnimatorCondition::Mode::IfNot && value == 0.f)
-                                || (condition->mode == AnimatorCondition::Mode::Equal && value == condition->threshold)
-                                || (condition->mode == AnimatorCondition::Mode::NotEqual && value != condition->threshold)
-                                || (condition->mode == AnimatorCondition::Mode::Greater && value > condition->threshold)
-                                || (condition->mode == AnimatorCondition::Mode::GreaterOrEqual && value >= condition->threshold)
-                                || (condition->mode == AnimatorCondition::Mode::Less && value < condition->threshold)
-                                || (condition->mode == AnimatorCondition::Mode::LessOrEqual && value <= condition->threshold)
-                                )) {
-                                shouldActiveTransition = false;
-                                break;                  
-                            }
-                            // Reset trigger state
-                            if (type == AnimatorParameterType::Trigger) {
-                                getController()->setParameter(condition->parameter, (int)AnimatorParameterType::Trigger, 0.f);
+                        // Check conditions
+                        bool shouldActiveTransition = true;
+                        for (auto& condition : transition->conditions) {
+                            if (getController()->hasParameter(condition->parameter)) {
+                                auto [type, value] = getController()->getParameter(condition->parameter);
+                                if (!((condition->mode == AnimatorCondition::Mode::If && value != 0.f)
+                                    || (condition->mode == AnimatorCondition::Mode::IfNot && value == 0.f)
+                                    || (condition->mode == AnimatorCondition::Mode::Equal && value == condition->threshold)
+                                    || (condition->mode == AnimatorCondition::Mode::NotEqual && value != condition->threshold)
+                                    || (condition->mode == AnimatorCondition::Mode::Greater && value > condition->threshold)
+                                    || (condition->mode == AnimatorCondition::Mode::GreaterOrEqual && value >= condition->threshold)
+                                    || (condition->mode == AnimatorCondition::Mode::Less && value < condition->threshold)
+                                    || (condition->mode == AnimatorCondition::Mode::LessOrEqual && value <= condition->threshold)
+                                    )) {
+                                    shouldActiveTransition = false;
+                                    break;                  
+                                }
+                                // Reset trigger state
+                                if (type == AnimatorParameterType::Trigger) {
+                                    getController()->setParameter(condition->parameter, (int)AnimatorParameterType::Trigger, 0.f);
+                                }
                             }
                         }
-                    }
-                    if (shouldActiveTransition) {
-                        activeTransition = transition;
-                        break;
+                        if (shouldActiveTransition) {
+                            activeTransition = transition;
+                            break;
+                        }
                     }
                 }
             }
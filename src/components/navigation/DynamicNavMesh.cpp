@@ -13,6 +13,9 @@
 #include <DetourTileCacheBuilder.h>
 #include <Recast.h>
 
+#include <algorithm>
+#include <chrono>
+
 #define TILECACHE_MAXLAYERS 255
 
 namespace ige::scene
@@ -192,6 +195,7 @@ namespace ige::scene
         m_compressor = std::make_unique<TileCompressor>();
         m_meshProcessor = std::make_unique<MeshProcess>(this);
 
+        NavObstacle::getDestroyedEvent().addListener(std::bind(static_cast<void (DynamicNavMesh::*)(NavObstacle*)>(&DynamicNavMesh::onDestroyed), this, std::placeholders::_1));
         NavObstacle::getActivatedEvent().addListener(std::bind(static_cast<void (DynamicNavMesh::*)(NavObstacle*)>(&DynamicNavMesh::onActivated), this, std::placeholders::_1));
         NavObstacle::getDeactivatedEvent().addListener(std::bind(static_cast<void (DynamicNavMesh::*)(NavObstacle*)>(&DynamicNavMesh::onDeactivated), this, std::placeholders::_1));
     }
@@ -200,6 +204,7 @@ namespace ige::scene
     {
         releaseNavMesh();
 
+        NavObstacle::getDestroyedEvent().removeAllListeners();
         NavObstacle::getActivatedEvent().removeAllListeners();
         NavObstacle::getDeactivatedEvent().removeAllListeners();
 
@@ -227,6 +232,7 @@ namespace ige::scene
         collectGeometries(geometryList);
         if (geometryList.empty())
             return true;
+        m_geometryHash = computeGeometryHash(geometryList);
 
         // Extend bounding box
         for (size_t i = 0; i < geometryList.size(); ++i)
@@ -260,13 +266,8 @@ namespace ige::scene
             params.maxTiles = maxTiles;
             params.maxPolys = maxPolys;
 
-            // Allocate nav mesh
-            m_navMesh = dtAllocNavMesh();
-            if (!m_navMesh)
-                return false;
-
-            // Initialize nav mesh
-            if (dtStatusFailed(m_navMesh->init(&params)))
+            // Allocate and initialize nav mesh
+            if (!createNavMesh(params))
             {
                 releaseNavMesh();
                 return false;
@@ -302,52 +303,44 @@ namespace ige::scene
             }
 
             // Build each tile
-            unsigned numTiles = 0;
-            for (int z = 0; z < m_numTilesZ; ++z)
-            {
-                for (int x = 0; x < m_numTilesX; ++x)
-                {
-                    TileCacheData tiles[TILECACHE_MAXLAYERS];
-                    int layerCt = buildTile(geometryList, x, z, tiles);
-                    for (int i = 0; i < layerCt; ++i)
-                    {
-                        dtCompressedTileRef tileRef;
-                        int status = m_tileCache->addTile(tiles[i].data, tiles[i].dataSize, DT_COMPRESSEDTILE_FREE_DATA, &tileRef);
-                        if (dtStatusFailed((dtStatus)status))
-                        {
-                            dtFree(tiles[i].data);
-                            tiles[i].data = nullptr;
-                        }
-                    }
-                    m_tileCache->buildNavMeshTilesAt(x, z, m_navMesh);
-                    ++numTiles;
-                }
-            }
+            buildTiles(geometryList, Vec2(0.f, 0.f), Vec2(m_numTilesX - 1.f, m_numTilesZ - 1.f));
 
             // For a full build it's necessary to update the nav mesh
             // not doing so will cause dependent components to crash, like CrowdManager
             m_tileCache->update(0, m_navMesh);
 
             // Scan for obstacles
-            std::vector<Component*> obstacles;
-            getOwner()->getComponentsRecursive(obstacles, "NavObstacle");
-            for (auto comp : obstacles)
-            {
-                auto obstacle = static_cast<NavObstacle*>(comp);
-                if (obstacle && obstacle->isEnabled())
-                {
-                    onActivated(obstacle);
-                }
-            }
+            onNavDataLoaded();
 
             m_navAgentManager.lock()->reactivateAllAgents();
         }
-
-        // TODO: Save/load the built data using filesystem
-        // auto meshBuff = getNavDataAttr();
         return true;
     }
 
+    //! Hash build settings and geometry, tile cache limits included
+    uint64_t DynamicNavMesh::computeGeometryHash(const std::vector<NavGeoInfo> &geometryList) const
+    {
+        uint32_t limits[] = {m_maxObstacles, m_maxLayers};
+        return hashBytes(NavMesh::computeGeometryHash(geometryList), limits, sizeof(limits));
+    }
+
+    //! Obstacles are not part of the baked data, add them to the tile cache again
+    void DynamicNavMesh::onNavDataLoaded()
+    {
+        std::vector<Component*> components;
+        getOwner()->getComponentsRecursive(components, "NavObstacle");
+        std::vector<NavObstacle*> obstacles;
+        for (auto comp : components)
+        {
+            auto obstacle = static_cast<NavObstacle*>(comp);
+            if (obstacle && obstacle->isEnabled())
+            {
+                obstacles.push_back(obstacle);
+            }
+        }
+        addObstacles(obstacles);
+    }
+
     //! Remove tile from navigation mesh.
     void DynamicNavMesh::removeTile(const Vec2 &tile)
     {
@@ -395,13 +388,7 @@ namespace ige::scene
         dtNavMeshParams params;
         buffer.read<dtNavMeshParams>(params);
 
-        m_navMesh = dtAllocNavMesh();
-        if (!m_navMesh)
-        {
-            return;
-        }
-
-        if (dtStatusFailed(m_navMesh->init(&params)))
+        if (!createNavMesh(params))
         {
             releaseNavMesh();
             return;
@@ -457,43 +444,9 @@ namespace ige::scene
         return tileBoundingBox.isPointInside(obstaclePosition);
     }
 
-    //! Build one tile of the navigation mesh. Return true if successful.
-    int DynamicNavMesh::buildTile(std::vector<NavGeoInfo> &geometryList, int x, int z, TileCacheData *tiles)
-    {
-        m_tileCache->removeTile(m_navMesh->getTileRefAt(x, z, 0), nullptr, nullptr);
-        const auto tileBoundingBox = getTileBoundingBox(Vec2(x, z));
-        auto build = DynamicNavBuildData(m_allocator.get());
-
-        rcConfig cfg;
-        memset(&cfg, 0, sizeof cfg);
-        cfg.cs = m_cellSize;
-        cfg.ch = m_cellHeight;
-        cfg.walkableSlopeAngle = m_agentMaxSlope;
-        cfg.walkableHeight = (int)ceilf(m_agentHeight / cfg.ch);
-        cfg.walkableClimb = (int)floorf(m_agentMaxClimb / cfg.ch);
-        cfg.walkableRadius = (int)ceilf(m_agentRadius / cfg.cs);
-        cfg.maxEdgeLen = (int)(m_edgeMaxLength / m_cellSize);
-        cfg.maxSimplificationError = m_edgeMaxError;
-        cfg.minRegionArea = (int)sqrtf(m_regionMinSize);
-        cfg.mergeRegionArea = (int)sqrtf(m_regionMergeSize);
-        cfg.maxVertsPerPoly = 6;
-        cfg.tileSize = m_tileSize;
-        cfg.borderSize = cfg.walkableRadius + 3; // Add padding
-        cfg.width = cfg.tileSize + cfg.borderSize * 2;
-        cfg.height = cfg.tileSize + cfg.borderSize * 2;
-        cfg.detailSampleDist = m_detailSampleDistance < 0.9f ? 0.0f : m_cellSize * m_detailSampleDistance;
-        cfg.detailSampleMaxError = m_cellHeight * m_detailSampleMaxError;
-
-        rcVcopy(cfg.bmin, tileBoundingBox.MinEdge.P());
-        rcVcopy(cfg.bmax, tileBoundingBox.MaxEdge.P());
-        cfg.bmin[0] -= cfg.borderSize * cfg.cs;
-        cfg.bmin[2] -= cfg.borderSize * cfg.cs;
-        cfg.bmax[0] += cfg.borderSize * cfg.cs;
-        cfg.bmax[2] += cfg.borderSize * cfg.cs;
-
-        auto expandedBox = AABBox(*reinterpret_cast<Vec3 *>(cfg.bmin), *reinterpret_cast<Vec3 *>(cfg.bmax));
-        getTileGeometry(&build, geometryList, expandedBox);
-
+    //! Rasterize collected geometry into compressed tile cache layers. Only touches the build data, safe to run on worker threads.
+    int DynamicNavMesh::buildTileLayers(DynamicNavBuildData &build, const rcConfig &cfg, int x, int z, TileCacheData *tiles) const
+    {
         if (build.vertices.empty() || build.indices.empty())
             return 0; // Nothing to do
 
@@ -595,40 +548,70 @@ namespace ige::scene
         return retCt;
     }
 
-    //! Build tiles in the rectangular area. Return number of built tiles.
-    uint32_t DynamicNavMesh::buildTiles(std::vector<NavGeoInfo> &geometryList, const Vec2 &from, const Vec2 &to)
+    //! DynamicNavTileJob: tile build data and the resulting compressed layers
+    struct DynamicNavTileJob : public NavTileJob
     {
+        //! Constructor
+        DynamicNavTileJob(dtTileCacheAlloc *allocator) : build(allocator) {}
+
+        //! Destructor, frees layers which were not added to the tile cache
+        ~DynamicNavTileJob() override
+        {
+            for (int i = 0; i < layerCt; ++i)
+                if (tiles[i].data)
+                    dtFree(tiles[i].data);
+        }
+
+        //! Build data
+        DynamicNavBuildData build;
+
+        //! Compressed layers
+        TileCacheData tiles[TILECACHE_MAXLAYERS] = {};
+        int layerCt = 0;
+    };
+
+    //! Gather geometry of the tile into a build job
+    std::unique_ptr<NavTileJob> DynamicNavMesh::createTileJob(std::vector<NavGeoInfo> &geometryList, const NavTriMesh &triMesh, int x, int z)
+    {
+        auto job = std::make_unique<DynamicNavTileJob>(m_allocator.get());
+        job->x = x;
+        job->z = z;
+        job->cfg = getTileConfig(x, z);
+        getTileGeometry(&job->build, geometryList, triMesh, job->cfg);
+        return job;
+    }
+
+    //! Build the job
+    void DynamicNavMesh::runTileJob(NavTileJob &job) const
+    {
+        auto &tileJob = static_cast<DynamicNavTileJob &>(job);
+        tileJob.layerCt = buildTileLayers(tileJob.build, tileJob.cfg, tileJob.x, tileJob.z, tileJob.tiles);
+    }
+
+    //! Replace the tile layers with the job result
+    uint32_t DynamicNavMesh::commitTileJob(NavTileJob &job)
+    {
+        auto &tileJob = static_cast<DynamicNavTileJob &>(job);
+
+        dtCompressedTileRef existing[TILECACHE_MAXLAYERS];
+        const int existingCt = m_tileCache->getTilesAt(tileJob.x, tileJob.z, existing, m_maxLayers);
+        for (int i = 0; i < existingCt; ++i)
+        {
+            unsigned char *data = nullptr;
+            if (!dtStatusFailed(m_tileCache->removeTile(existing[i], &data, nullptr)) && data != nullptr)
+                dtFree(data);
+        }
+
         uint32_t numTiles = 0;
-        for (int z = from.Y(); z <= to.Y(); ++z)
+        for (int i = 0; i < tileJob.layerCt; ++i)
         {
-            for (int x = from.X(); x <= to.X(); ++x)
+            dtCompressedTileRef tileRef;
+            int status = m_tileCache->addTile(tileJob.tiles[i].data, tileJob.tiles[i].dataSize, DT_COMPRESSEDTILE_FREE_DATA, &tileRef);
+            if (!dtStatusFailed((dtStatus)status))
             {
-                dtCompressedTileRef existing[TILECACHE_MAXLAYERS];
-                const int existingCt = m_tileCache->getTilesAt(x, z, existing, m_maxLayers);
-                for (int i = 0; i < existingCt; ++i)
-                {
-                    unsigned char *data = nullptr;
-                    if (!dtStatusFailed(m_tileCache->removeTile(existing[i], &data, nullptr)) && data != nullptr)
-                        dtFree(data);
-                }
-
-                TileCacheData tiles[TILECACHE_MAXLAYERS];
-                int layerCt = buildTile(geometryList, x, z, tiles);
-                for (int i = 0; i < layerCt; ++i)
-                {
-                    dtCompressedTileRef tileRef;
-                    int status = m_tileCache->addTile(tiles[i].data, tiles[i].dataSize, DT_COMPRESSEDTILE_FREE_DATA, &tileRef);
-                    if (dtStatusFailed((dtStatus)status))
-                    {
-                        dtFree(tiles[i].data);
-                        tiles[i].data = nullptr;
-                    }
-                    else
-                    {
-                        m_tileCache->buildNavMeshTile(tileRef, m_navMesh);
-                        ++numTiles;
-                    }
-                }
+                tileJob.tiles[i].data = nullptr; // Owned by the tile cache
+                m_tileCache->buildNavMeshTile(tileRef, m_navMesh);
+                ++numTiles;
             }
         }
         return numTiles;
@@ -667,6 +650,8 @@ namespace ige::scene
             dtFreeTileCache(m_tileCache);
             m_tileCache = nullptr;
         }
+        m_pendingAdds.clear();
+        m_pendingRemoves.clear();
     }
 
     //! Write tile data.
@@ -714,10 +699,13 @@ namespace ige::scene
                 m_tileQueue.push_back(tileIdx);
         }
 
+        std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+        ++m_navMeshVersion;
         for (size_t i = 0; i < m_tileQueue.size(); ++i)
             m_tileCache->buildNavMeshTilesAt(m_tileQueue[i].X(), m_tileQueue[i].Y(), m_navMesh);
 
         m_tileCache->update(0, m_navMesh);
+        updatePolyTable();
         return true;
     }
 
@@ -728,41 +716,156 @@ namespace ige::scene
 
     void DynamicNavMesh::onDestroyed(NavObstacle *obstacle)
     {
+        removeObstacles({ obstacle });
     }
 
     //! Activate/Deactivate event
     void DynamicNavMesh::onActivated(NavObstacle *obstacle)
     {
-        if (m_tileCache)
+        addObstacles({ obstacle });
+    }
+
+    void DynamicNavMesh::onDeactivated(NavObstacle *obstacle)
+    {
+        removeObstacles({ obstacle });
+    }
+
+    //! Queue obstacles to add
+    void DynamicNavMesh::addObstacles(const std::vector<NavObstacle*>& obstacles)
+    {
+        if (!m_tileCache)
+            return;
+
+        for (auto obstacle : obstacles)
         {
-            float pos[3];
-            auto obsPos = obstacle->getOwner()->getTransform()->getPosition();
-            rcVcopy(pos, obsPos.P());
-            dtObstacleRef refHolder;
-            if (dtStatusFailed(m_tileCache->addObstacle(pos, obstacle->getRadius(), obstacle->getHeight(), &refHolder)))
-                return;
-            obstacle->setObstacleId(refHolder);
+            if (obstacle && std::find(m_pendingAdds.begin(), m_pendingAdds.end(), obstacle) == m_pendingAdds.end())
+                m_pendingAdds.push_back(obstacle);
         }
     }
 
-    void DynamicNavMesh::onDeactivated(NavObstacle *obstacle)
+    //! Queue obstacles to remove
+    void DynamicNavMesh::removeObstacles(const std::vector<NavObstacle*>& obstacles)
     {
-        if (m_tileCache && obstacle->getObstacleId() > 0)
+        for (auto obstacle : obstacles)
         {
+            if (!obstacle)
+                continue;
+
+            m_pendingAdds.erase(std::remove(m_pendingAdds.begin(), m_pendingAdds.end(), obstacle), m_pendingAdds.end());
+            if (m_tileCache && obstacle->getObstacleId() > 0)
+                m_pendingRemoves.push_back(obstacle->getObstacleId());
+            obstacle->setObstacleId(0);
+        }
+    }
+
+    //! Queue enabled obstacles to move to their current transform
+    void DynamicNavMesh::moveObstacles(const std::vector<NavObstacle*>& obstacles)
+    {
+        removeObstacles(obstacles);
+
+        std::vector<NavObstacle*> enabled;
+        for (auto obstacle : obstacles)
+        {
+            if (obstacle && obstacle->isEnabled())
+                enabled.push_back(obstacle);
+        }
+        addObstacles(enabled);
+    }
+
+    //! Add the obstacle to the tile cache with its shape
+    dtStatus DynamicNavMesh::addTileCacheObstacle(NavObstacle* obstacle, dtObstacleRef& ref)
+    {
+        auto transform = obstacle->getOwner()->getTransform();
+        const auto& obsPos = transform->getPosition();
+        const auto& size = obstacle->getSize();
 
-            if (dtStatusFailed(m_tileCache->removeObstacle(obstacle->getObstacleId())))
+        switch (obstacle->getShape())
+        {
+            case NavObstacle::Shape::BOX:
             {
-                return;
+                float bmin[3] = { obsPos.X() - size.X() * 0.5f, obsPos.Y(), obsPos.Z() - size.Z() * 0.5f };
+                float bmax[3] = { obsPos.X() + size.X() * 0.5f, obsPos.Y() + size.Y(), obsPos.Z() + size.Z() * 0.5f };
+                return m_tileCache->addBoxObstacle(bmin, bmax, &ref);
+            }
+
+            case NavObstacle::Shape::ORIENTED_BOX:
+            {
+                // Tile cache only rotates boxes around the Y axis
+                const auto& rot = transform->getRotation();
+                float yaw = atan2f(2.f * (rot[3] * rot[1] + rot[0] * rot[2]), 1.f - 2.f * (rot[0] * rot[0] + rot[1] * rot[1]));
+                float center[3] = { obsPos.X(), obsPos.Y() + size.Y() * 0.5f, obsPos.Z() };
+                float halfExtents[3] = { size.X() * 0.5f, size.Y() * 0.5f, size.Z() * 0.5f };
+                return m_tileCache->addBoxObstacle(center, halfExtents, yaw, &ref);
+            }
+
+            default:
+            {
+                float pos[3];
+                rcVcopy(pos, obsPos.P());
+                return m_tileCache->addObstacle(pos, obstacle->getRadius(), obstacle->getHeight(), &ref);
             }
-            obstacle->setObstacleId(0);
         }
     }
 
+    //! Send queued obstacle requests to the tile cache, the rest wait for the next update
+    void DynamicNavMesh::flushObstacleRequests()
+    {
+        size_t removed = 0;
+        for (; removed < m_pendingRemoves.size(); ++removed)
+        {
+            auto status = m_tileCache->removeObstacle(m_pendingRemoves[removed]);
+            if (dtStatusDetail(status, DT_BUFFER_TOO_SMALL))
+                break;
+            m_bObstaclesChanged = true;
+        }
+        m_pendingRemoves.erase(m_pendingRemoves.begin(), m_pendingRemoves.begin() + removed);
+
+        size_t added = 0;
+        for (; added < m_pendingAdds.size(); ++added)
+        {
+            dtObstacleRef refHolder = 0;
+            auto status = addTileCacheObstacle(m_pendingAdds[added], refHolder);
+            if (dtStatusDetail(status, DT_BUFFER_TOO_SMALL))
+                break;
+            if (dtStatusSucceed(status))
+            {
+                m_pendingAdds[added]->setObstacleId(refHolder);
+                m_bObstaclesChanged = true;
+            }
+        }
+        m_pendingAdds.erase(m_pendingAdds.begin(), m_pendingAdds.begin() + added);
+    }
+
     //! Update
     void DynamicNavMesh::onUpdate(float dt)
     {
         if (m_tileCache && m_navMesh && isEnabled())
-            m_tileCache->update(dt, m_navMesh);
+        {
+            // Obstacle changes rebuild tiles, within the tile and time budget
+            std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+            flushObstacleRequests();
+
+            bool upToDate = false;
+            bool tilesRebuilt = false;
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < m_tileBudget && !upToDate; ++i)
+            {
+                // An update with queued obstacle work rebuilds tiles
+                tilesRebuilt |= m_bObstaclesChanged;
+                m_tileCache->update(dt, m_navMesh, &upToDate);
+                m_bObstaclesChanged = !upToDate;
+                const auto elapsed = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+                if (elapsed >= m_timeBudget)
+                    break;
+            }
+
+            // Every frame with rebuilt tiles, so area flag overrides are reapplied and flow fields rebuilt
+            if (tilesRebuilt)
+                ++m_navMeshVersion;
+        }
+
+        // After the tile cache, so the poly table and flow fields catch up in the same frame
+        NavMesh::onUpdate(dt);
     }
 
     //! Serialize
@@ -771,6 +874,8 @@ namespace ige::scene
         NavMesh::to_json(j);
         j["maxObs"] = getMaxObstacles();
         j["maxLayers"] = getMaxLayers();
+        j["tileBudget"] = getTileBudget();
+        j["timeBudget"] = getTimeBudget();
     }
 
     //! Deserialize
@@ -778,6 +883,8 @@ namespace ige::scene
     {
         setMaxObstacles(j.value("maxObs", 1024));
         setMaxLayers(j.value("maxLayers", 16));
+        setTileBudget(j.value("tileBudget", 4));
+        setTimeBudget(j.value("timeBudget", 2.f));
         NavMesh::from_json(j);
     }
 
@@ -798,6 +905,14 @@ namespace ige::scene
         {
             setMaxLayers(val);
         }
+        else if (key.compare("tileBudget") == 0)
+        {
+            setTileBudget(val);
+        }
+        else if (key.compare("timeBudget") == 0)
+        {
+            setTimeBudget(val);
+        }
         else
         {
             NavMesh::setProperty(key, val);
@@ -93,11 +93,26 @@ namespace ige::scene
         /// Return whether the obstacle is touching the given tile.
         bool isObstacleInTile(NavObstacle *obstacle, const Vec2 &tile) const;
 
-        //! Build one tile of the navigation mesh. Return true if successful.
-        int buildTile(std::vector<NavGeoInfo>& geometryList, int x, int z, TileCacheData* tiles);
+        //! Queue obstacles to add. Requests reach the tile cache on update, within its request buffer, and tiles rebuild within the budget.
+        void addObstacles(const std::vector<NavObstacle*>& obstacles);
+
+        //! Queue obstacles to remove
+        void removeObstacles(const std::vector<NavObstacle*>& obstacles);
+
+        //! Queue enabled obstacles to move to their current transform
+        void moveObstacles(const std::vector<NavObstacle*>& obstacles);
+
+        //! Max tiles rebuilt per update after obstacle changes
+        int getTileBudget() const { return m_tileBudget; }
+        void setTileBudget(int budget) { m_tileBudget = std::max(budget, 1); }
+
+        //! Max time spent rebuilding tiles per update, in milliseconds. At least one tile is rebuilt.
+        float getTimeBudget() const { return m_timeBudget; }
+        void setTimeBudget(float ms) { m_timeBudget = std::max(ms, 0.f); }
+
+        //! Build compressed layers from collected tile geometry, thread safe. Return number of layers.
+        int buildTileLayers(DynamicNavBuildData& build, const rcConfig& cfg, int x, int z, TileCacheData* tiles) const;
 
-        //! Build tiles in the rectangular area. Return number of built tiles.
-        uint32_t buildTiles(std::vector<NavGeoInfo>& geometryList, const Vec2& from, const Vec2& to) override;
 
         //! Off-mesh links to be rebuilt in the mesh processor.
         std::vector<OffMeshLink*> collectOffMeshLinks(const AABBox& bounds);
@@ -118,6 +133,27 @@ namespace ige::scene
         //! Release tile cache
         void releaseTileCache();
 
+        //! Send queued obstacle requests to the tile cache until its request buffer is full
+        void flushObstacleRequests();
+
+        //! Add the obstacle to the tile cache with its shape
+        dtStatus addTileCacheObstacle(NavObstacle* obstacle, dtObstacleRef& ref);
+
+        //! Gather geometry of the tile into a build job
+        virtual std::unique_ptr<NavTileJob> createTileJob(std::vector<NavGeoInfo> &geometryList, const NavTriMesh &triMesh, int x, int z) override;
+
+        //! Build the job, thread safe
+        virtual void runTileJob(NavTileJob &job) const override;
+
+        //! Replace the tile layers with the job result
+        virtual uint32_t commitTileJob(NavTileJob &job) override;
+
+        //! Hash build settings and geometry, tile cache limits included
+        virtual uint64_t computeGeometryHash(const std::vector<NavGeoInfo> &geometryList) const override;
+
+        //! Add obstacles to the loaded tile cache
+        virtual void onNavDataLoaded() override;
+
         //! Create/Destroy event
         void onCreated(NavObstacle* obstacle);
         void onDestroyed(NavObstacle* obstacle);
@@ -159,5 +195,16 @@ namespace ige::scene
 
         //! Queue of tiles to be built.
         std::vector<Vec2> m_tileQueue;
+
+        //! Obstacles added or removed since the tile cache was last up to date
+        bool m_bObstaclesChanged = false;
+
+        //! Obstacles waiting to be added, and tile cache obstacles waiting to be removed
+        std::vector<NavObstacle*> m_pendingAdds;
+        std::vector<dtObstacleRef> m_pendingRemoves;
+
+        //! Tile rebuild budget per update
+        int m_tileBudget = 4;
+        float m_timeBudget = 2.f;
     };
 } // namespace ige::scene
@@ -44,27 +44,7 @@ namespace ige::scene
         if (!agent)
             return;
 
-        auto newPos = Vec3(agent->npos[0], agent->npos[1], agent->npos[2]);
-        auto newVel = Vec3(agent->vel[0], agent->vel[1], agent->vel[2]);
-
-        // Notify parent node of the reposition
-        if (newPos != m_previousPosition)
-        {
-            m_previousPosition = newPos;
-
-            if (m_bUpdateNodePosition)
-            {
-                m_bIgnoreTransformChanges = true;
-                auto rigidbody = getOwner()->getComponent<Rigidbody>();
-                if (rigidbody != nullptr) {
-                    rigidbody->movePosition(PhysicHelper::to_btVector3(newPos));
-                }
-                else {
-                    getOwner()->getTransform()->setPosition(newPos);
-                }
-                m_bIgnoreTransformChanges = false;
-            }
-        }
+        // Position is written back by the manager right after the crowd update
 
         // Send a notification event if we've reached the destination
         TargetState newTargetState = getTargetState();
@@ -76,6 +56,28 @@ namespace ige::scene
         }
     }
 
+    //! Write the crowd position to the owner
+    void NavAgent::updatePosition(const Vec3 &position)
+    {
+        // Notify parent node of the reposition
+        if (position == m_previousPosition)
+            return;
+        m_previousPosition = position;
+
+        if (m_bUpdateNodePosition)
+        {
+            m_bIgnoreTransformChanges = true;
+            auto rigidbody = getOwner()->getComponent<Rigidbody>();
+            if (rigidbody != nullptr) {
+                rigidbody->movePosition(PhysicHelper::to_btVector3(position));
+            }
+            else {
+                getOwner()->getTransform()->setPosition(position);
+            }
+            m_bIgnoreTransformChanges = false;
+        }
+    }
+
     void NavAgent::onRuntimeFixedUpdate(float dt)
     {
     }
@@ -100,6 +102,7 @@ namespace ige::scene
         {
             getDeactivatedEvent().invoke(this);
             m_bIsActivated = false;
+            m_flowField = nullptr;
         }
     }
 
@@ -115,10 +118,25 @@ namespace ige::scene
             if (agentPos != m_previousPosition)
                 agentPos = m_previousPosition;
 
-            dtPolyRef nearestRef;
-            auto nearestPos = m_manager->findNearestPoint(m_targetPosition, m_queryFilterType, &nearestRef);
-            m_manager->getCrowd()->requestMoveTarget(getAgentId(), nearestRef, nearestPos.P());
+            requestTarget();
+        }
+    }
+
+    //! Request the crowd move target, or the shared flow field toward it
+    void NavAgent::requestTarget()
+    {
+        if (m_bUseFlowField)
+        {
+            // Steered by the manager with velocity requests
+            m_flowField = m_manager->getFlowField(m_targetPosition, m_queryFilterType);
+            m_manager->getCrowd()->resetMoveTarget(getAgentId());
+            return;
         }
+
+        m_flowField = nullptr;
+        dtPolyRef nearestRef;
+        auto nearestPos = m_manager->findNearestPoint(m_targetPosition, m_queryFilterType, &nearestRef);
+        m_manager->getCrowd()->requestMoveTarget(getAgentId(), nearestRef, nearestPos.P());
     }
 
     const dtCrowdAgent *NavAgent::getDetourCrowdAgent() const
@@ -186,6 +204,18 @@ namespace ige::scene
             params.queryFilterType = (uint8_t)m_queryFilterType;
             params.obstacleAvoidanceType = (uint8_t)m_obstacleAvoidanceType;
 
+            // Far or off-screen agents: no velocity sampling, fewer neighbours
+            if (m_lod == NavLod::MEDIUM)
+            {
+                params.updateFlags &= ~(DT_CROWD_OBSTACLE_AVOIDANCE | DT_CROWD_OPTIMIZE_TOPO);
+                params.collisionQueryRange *= 0.5f;
+            }
+            else if (m_lod == NavLod::LOW)
+            {
+                params.updateFlags &= ~(DT_CROWD_OBSTACLE_AVOIDANCE | DT_CROWD_OPTIMIZE_TOPO | DT_CROWD_SEPARATION);
+                params.collisionQueryRange = std::min(params.collisionQueryRange, m_radius);
+            }
+
             if (m_manager)
                 m_manager->getCrowd()->updateAgentParameters(getAgentId(), &params);
         }
@@ -197,6 +227,8 @@ namespace ige::scene
         if (!m_manager)
             return false;
         const auto *agent = m_manager->getDetourCrowdAgent(m_agentId);
+        if (agent && m_flowField)
+            return agent->corridor.getFirstPoly() == m_flowField->goalRef && dtVdist2D(agent->npos, m_flowField->localGoal.P()) <= agent->params.radius;
         if (!agent || !agent->ncorners)
             return false;
         return (agent->cornerFlags[agent->ncorners - 1] & DT_STRAIGHTPATH_END && dtVdist2D(agent->npos, &agent->cornerVerts[(agent->ncorners - 1) * 3]) <= agent->params.radius);
@@ -217,9 +249,7 @@ namespace ige::scene
 
             if (isInCrowd())
             {
-                dtPolyRef nearestRef;
-                auto nearestPos = m_manager->findNearestPoint(pos, m_queryFilterType, &nearestRef);
-                m_manager->getCrowd()->requestMoveTarget(getAgentId(), nearestRef, nearestPos.P());
+                requestTarget();
 
                 // Start moving
                 auto* agent = const_cast<dtCrowdAgent*>(getDetourCrowdAgent());
@@ -232,10 +262,22 @@ namespace ige::scene
     //! Reset target
     void NavAgent::resetTarget()
     {
+        m_flowField = nullptr;
         if (isInCrowd())
             m_manager->getCrowd()->resetMoveTarget(getAgentId());
     }
 
+    //! Set use flow field
+    void NavAgent::setUseFlowField(bool use)
+    {
+        if (m_bUseFlowField != use)
+        {
+            m_bUseFlowField = use;
+            if (isInCrowd())
+                requestTarget();
+        }
+    }
+
     //! Set update node position
     void NavAgent::setUpdateNodePosition(bool update)
     {
@@ -312,6 +354,16 @@ namespace ige::scene
         }
     }
 
+    //! Set crowd level of detail
+    void NavAgent::setLod(NavLod lod)
+    {
+        if (m_lod != lod)
+        {
+            m_lod = lod;
+            updateParameters();
+        }
+    }
+
     //! Set navigation pushiness
     void NavAgent::setNavigationPushiness(NavPushiness pushiness)
     {
@@ -356,6 +408,7 @@ namespace ige::scene
         Component::to_json(j);
         j["targetPos"] = getTargetPosition();
         j["syncPos"] = isUpdateNodePosition();
+        j["flowField"] = isUseFlowField();
         j["maxAcc"] = getMaxAcceleration();
         j["maxSpeed"] = getMaxSpeed();
         j["radius"] = getRadius();
@@ -372,6 +425,7 @@ namespace ige::scene
         Initialize();
         setTargetPosition(j.value("targetPos", Vec3(0.f, 0.f, 0.f)));
         setUpdateNodePosition(j.value("syncPos", true));
+        setUseFlowField(j.value("flowField", false));
         setMaxAcceleration(j.value("maxAcc", 5.f));
         setMaxSpeed(j.value("maxSpeed", 3.f));
         setRadius(j.value("radius", 0.f));
@@ -394,6 +448,10 @@ namespace ige::scene
         {
             setUpdateNodePosition(val);
         }
+        else if (key.compare("flowField") == 0)
+        {
+            setUseFlowField(val);
+        }
         else if (key.compare("maxAcc") == 0)
         {
             setMaxAcceleration(val);
@@ -11,6 +11,7 @@ class dtCrowdAgent;
 namespace ige::scene
 {
     class NavAgentManager;
+    struct NavFlowField;
 
     //! NavAgent
     class NavAgent : public RuntimeComponent
@@ -61,6 +62,14 @@ namespace ige::scene
             NONE
         };
 
+        //! NavLod: crowd update level of detail, set by the manager from the camera
+        enum class NavLod
+        {
+            HIGH = 0,
+            MEDIUM,
+            LOW
+        };
+
     public:
         //! Constructor
         NavAgent(SceneObject& owner);
@@ -101,6 +110,13 @@ namespace ige::scene
         bool isUpdateNodePosition() const { return m_bUpdateNodePosition; }
         void setUpdateNodePosition(bool update);
 
+        //! Follow the flow field shared by agents with the same target instead of a private path
+        bool isUseFlowField() const { return m_bUseFlowField; }
+        void setUseFlowField(bool use);
+
+        //! Flow field being followed, null when using a private path
+        const std::shared_ptr<NavFlowField> &getFlowField() const { return m_flowField; }
+
         //! Agent's max acceleration
         float getMaxAcceleration() const { return m_maxAccel; }
         void setMaxAcceleration(float acc);
@@ -133,9 +149,16 @@ namespace ige::scene
         NavPushiness getNavigationPushiness() const { return m_navPushiness; }
         void setNavigationPushiness(NavPushiness pushiness);
 
+        //! Agent's crowd level of detail
+        NavLod getLod() const { return m_lod; }
+        void setLod(NavLod lod);
+
         //! Agent's previous position
         const Vec3 &getPreviousPosition() const { return m_previousPosition; }
 
+        //! Write the crowd position to the owner, called by the manager after the crowd update
+        void updatePosition(const Vec3 &position);
+
         //! Agent's previous target state
         TargetState getPreviousTargetState() const { return m_previousTargetState; }
         TargetState getTargetState() const;
@@ -184,6 +207,9 @@ namespace ige::scene
 
         void requestMove();
 
+        //! Request the crowd move target, or the shared flow field toward it
+        void requestTarget();
+
         //! Serialize
         virtual void to_json(json& j) const override;
 
@@ -200,6 +226,12 @@ namespace ige::scene
         //! Update position by Detour crowd manager
         bool m_bUpdateNodePosition = true;
 
+        //! Follow the shared flow field
+        bool m_bUseFlowField = false;
+
+        //! Flow field being followed
+        std::shared_ptr<NavFlowField> m_flowField = nullptr;
+
         //! Agent's max acceleration
         float m_maxAccel = 5.f;
 
@@ -224,6 +256,9 @@ namespace ige::scene
         //! Agent's navigation pushiness. The higher the setting, the stronger the agent pushes its colliding neighbors around.
         NavPushiness m_navPushiness = NavPushiness::HIGH;
 
+        //! Agent's crowd level of detail. Lower levels drop obstacle avoidance, shrink the neighbour query range and skip crowd updates.
+        NavLod m_lod = NavLod::HIGH;
+
         //! Agent's previous position used to check for position changes.
         Vec3 m_previousPosition = {0.f, 0.f, 0.f};
 
@@ -1,8 +1,12 @@
 #include "components/navigation/NavAgentManager.h"
 #include "components/navigation/DynamicNavMesh.h"
+#include "scene/Scene.h"
 #include "scene/SceneObject.h"
+#include "components/CameraComponent.h"
 #include "components/TransformComponent.h"
+#include "utils/ThreadPool.h"
 
+#include <DetourCommon.h>
 #include <DetourCrowd.h>
 
 namespace ige::scene
@@ -121,7 +125,159 @@ namespace ige::scene
     {
         if (!m_bInitialized)
             return;
+
+        m_frameAgents.clear();
+        for (auto &weakAgent : m_agents)
+        {
+            auto agent = weakAgent.lock();
+            if (agent && agent->isInCrowd())
+                m_frameAgents.push_back(agent);
+        }
+
+        updateAgentLods();
+        updateFlowFieldAgents();
+        updateCrowd(dt);
+        writeBackPositions();
+        m_frameAgents.clear();
+    }
+
+    //! Classify agents by distance to the active camera and visibility
+    void NavAgentManager::updateAgentLods()
+    {
+        if (!m_bLodEnabled)
+            return;
+
+        auto scene = getOwner()->getScene();
+        auto camera = scene ? scene->getActiveCamera() : nullptr;
+        if (!camera)
+            return;
+
+        const auto cameraPos = camera->getPosition();
+        Mat4 proj, viewInv;
+        camera->getProjectionMatrix(proj);
+        camera->getViewInverseMatrix(viewInv);
+        const auto viewProj = proj * viewInv.Inverse();
+        const auto nearDistSqr = m_lodDistances.X() * m_lodDistances.X();
+        const auto farDistSqr = m_lodDistances.Y() * m_lodDistances.Y();
+
+        // Parameter updates only touch the agent's own crowd slot
+        ThreadPool::getInstance()->parallelFor((int)m_frameAgents.size(), [&](int begin, int end) {
+            for (int i = begin; i < end; ++i)
+            {
+                auto &agent = m_frameAgents[i];
+                const auto position = agent->getPosition();
+                const auto distSqr = (position - cameraPos).LengthSqr();
+
+                auto lod = NavAgent::NavLod::HIGH;
+                if (distSqr > farDistSqr)
+                    lod = NavAgent::NavLod::LOW;
+                else if (distSqr > nearDistSqr)
+                    lod = NavAgent::NavLod::MEDIUM;
+
+                // Off-screen, with a margin for the agent size
+                if (lod == NavAgent::NavLod::HIGH)
+                {
+                    const auto clip = viewProj * Vec4(position.X(), position.Y(), position.Z(), 1.f);
+                    const auto w = clip.W() * 1.1f + agent->getRadius();
+                    if (clip.W() <= 0.f || std::abs(clip.X()) > w || std::abs(clip.Y()) > w)
+                        lod = NavAgent::NavLod::MEDIUM;
+                }
+                agent->setLod(lod);
+            }
+        }, 64);
+    }
+
+    //! Steer agents following flow fields
+    void NavAgentManager::updateFlowFieldAgents()
+    {
+        auto navMesh = getNavMesh();
+        if (!navMesh || !navMesh->getNavMesh())
+            return;
+
+        // Fields are read only here and velocity requests only touch the agent's own crowd slot
+        const dtNavMesh *detourNavMesh = navMesh->getNavMesh();
+        ThreadPool::getInstance()->parallelFor((int)m_frameAgents.size(), [&](int begin, int end) {
+            for (int i = begin; i < end; ++i)
+            {
+                auto &agent = m_frameAgents[i];
+                if (!agent->getFlowField())
+                    continue;
+
+                const auto *crowdAgent = m_crowd->getAgent(agent->getAgentId());
+                if (!crowdAgent || !crowdAgent->active || crowdAgent->state != DT_CROWDAGENT_STATE_WALKING)
+                    continue;
+
+                // Steer to the portal toward the next polygon, or to the goal on the goal polygon
+                const auto &field = *agent->getFlowField();
+                const auto *node = field.getNode(detourNavMesh, crowdAgent->corridor.getFirstPoly());
+                if (node && node->next && dtVdist2DSqr(node->target.P(), crowdAgent->npos) < 0.0001f)
+                    node = field.getNode(detourNavMesh, node->next);
+                float velocity[3] = {0.f, 0.f, 0.f};
+                if (node)
+                {
+                    float dir[3];
+                    dtVsub(dir, node->target.P(), crowdAgent->npos);
+                    dir[1] = 0.f;
+                    const auto dist = dtVlen(dir);
+                    const auto radius = std::max(crowdAgent->params.radius, 0.01f);
+                    if (dist > 0.001f && (node->next || dist > radius))
+                    {
+                        // Slow down when approaching the goal
+                        auto speed = crowdAgent->params.maxSpeed;
+                        if (!node->next)
+                            speed *= std::min(dist / (radius * 2.f), 1.f);
+                        dtVscale(velocity, dir, speed / dist);
+                    }
+                }
+                m_crowd->requestMoveVelocity(agent->getAgentId(), velocity);
+            }
+        }, 64);
+    }
+
+    //! Update the crowd, low LOD agents sit out between their turns
+    void NavAgentManager::updateCrowd(float dt)
+    {
+        ++m_frameCount;
+        std::vector<dtCrowdAgent *> skippedAgents;
+        if (m_bLodEnabled && m_lowLodInterval > 1)
+        {
+            for (auto &agent : m_frameAgents)
+            {
+                if (agent->getLod() != NavAgent::NavLod::LOW || (m_frameCount + agent->getAgentId()) % m_lowLodInterval == 0)
+                    continue;
+                auto *crowdAgent = m_crowd->getEditableAgent(agent->getAgentId());
+                if (crowdAgent && crowdAgent->active && crowdAgent->state == DT_CROWDAGENT_STATE_WALKING)
+                {
+                    crowdAgent->active = false;
+                    skippedAgents.push_back(crowdAgent);
+                }
+            }
+        }
+
         m_crowd->update(dt, nullptr);
+
+        // Extrapolate skipped agents along their corridor. They left the proximity grid for this update,
+        // so other agents do not avoid them and they do not avoid others until their next turn.
+        auto *navQuery = const_cast<dtNavMeshQuery *>(m_crowd->getNavMeshQuery());
+        for (auto *crowdAgent : skippedAgents)
+        {
+            crowdAgent->active = true;
+            float target[3];
+            dtVmad(target, crowdAgent->npos, crowdAgent->vel, dt);
+            if (crowdAgent->corridor.movePosition(target, navQuery, m_crowd->getFilter(crowdAgent->params.queryFilterType)))
+                dtVcopy(crowdAgent->npos, crowdAgent->corridor.getPos());
+        }
+    }
+
+    //! Write crowd positions to the agent owners in one pass
+    void NavAgentManager::writeBackPositions()
+    {
+        for (auto &agent : m_frameAgents)
+        {
+            const auto *crowdAgent = m_crowd->getAgent(agent->getAgentId());
+            if (crowdAgent && crowdAgent->active)
+                agent->updatePosition(Vec3(crowdAgent->npos[0], crowdAgent->npos[1], crowdAgent->npos[2]));
+        }
     }
 
     void NavAgentManager::onRuntimeFixedUpdate(float dt)
@@ -132,6 +288,25 @@ namespace ige::scene
     {
     }
 
+    //! Enable/disable agent LOD
+    void NavAgentManager::setLodEnabled(bool enable)
+    {
+        if (m_bLodEnabled != enable)
+        {
+            m_bLodEnabled = enable;
+
+            // Back to full quality
+            if (!m_bLodEnabled)
+            {
+                for (auto &agent : m_agents)
+                {
+                    if (!agent.expired())
+                        agent.lock()->setLod(NavAgent::NavLod::HIGH);
+                }
+            }
+        }
+    }
+
     //! Get the detour crowd agent.
     const dtCrowdAgent *NavAgentManager::getDetourCrowdAgent(int agent) const
     {
@@ -247,6 +422,42 @@ namespace ige::scene
         }
     }
 
+    //! Queue an asynchronous path query, return a ticket for the result
+    uint32_t NavAgentManager::requestPath(const Vec3 &start, const Vec3 &end, int queryFilterType, int priority)
+    {
+        if (m_crowd && !m_navMesh.expired())
+        {
+            auto extend = m_crowd->getQueryExtents();
+            return m_navMesh.lock()->requestPath(start, end, Vec3(extend[0], extend[1], extend[2]), m_crowd->getFilter(queryFilterType), priority);
+        }
+        return 0;
+    }
+
+    bool NavAgentManager::cancelPath(uint32_t ticket)
+    {
+        return !m_navMesh.expired() && m_navMesh.lock()->cancelPath(ticket);
+    }
+
+    NavMesh::EPathStatus NavAgentManager::getPathStatus(uint32_t ticket) const
+    {
+        return m_navMesh.expired() ? NavMesh::EPathStatus::INVALID : m_navMesh.lock()->getPathStatus(ticket);
+    }
+
+    bool NavAgentManager::getPathResult(uint32_t ticket, std::vector<Vec3> &dest)
+    {
+        dest.clear();
+        return !m_navMesh.expired() && m_navMesh.lock()->getPathResult(ticket, dest);
+    }
+
+    //! Return the flow field toward the goal
+    std::shared_ptr<NavFlowField> NavAgentManager::getFlowField(const Vec3 &goal, int queryFilterType)
+    {
+        if (!m_crowd || m_navMesh.expired())
+            return nullptr;
+        auto extend = m_crowd->getQueryExtents();
+        return m_navMesh.lock()->getFlowField(goal, Vec3(extend[0], extend[1], extend[2]), m_crowd->getFilter(queryFilterType));
+    }
+
     //! Return a random point on the navigation mesh
     Vec3 NavAgentManager::getRandomPoint(int queryFilterType, dtPolyRef *randomRef)
     {
@@ -379,6 +590,9 @@ namespace ige::scene
         Component::to_json(j);
         j["maxAgents"] = getMaxAgentNumber();
         j["maxAgentRadius"] = getMaxAgentRadius();
+        j["lod"] = isLodEnabled();
+        j["lodDist"] = getLodDistances();
+        j["lodInterval"] = getLowLodInterval();
     }
 
     //! Deserialize
@@ -386,6 +600,9 @@ namespace ige::scene
     {
         setMaxAgentNumber(j.value("maxAgents", 512));
         setMaxAgentRadius(j.value("maxAgentRadius", 1.f));
+        setLodEnabled(j.value("lod", false));
+        setLodDistances(j.value("lodDist", Vec2(30.f, 80.f)));
+        setLowLodInterval(j.value("lodInterval", 4));
         Component::from_json(j);
     }
 } // namespace ige::scene
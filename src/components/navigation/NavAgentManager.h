@@ -108,6 +108,18 @@ namespace ige::scene
         //! Agents
         const std::vector<std::weak_ptr<NavAgent>> &getAgents() const { return m_agents; }
 
+        //! Agent LOD: far or off-screen agents drop avoidance, query fewer neighbours and skip crowd updates
+        bool isLodEnabled() const { return m_bLodEnabled; }
+        void setLodEnabled(bool enable = true);
+
+        //! Distances from the active camera where agents switch to medium and to low LOD, off-screen agents use at least medium
+        const Vec2 &getLodDistances() const { return m_lodDistances; }
+        void setLodDistances(const Vec2 &distances) { m_lodDistances = distances; }
+
+        //! Low LOD agents are integrated by the crowd once every interval frames and extrapolated in between
+        int getLowLodInterval() const { return m_lowLodInterval; }
+        void setLowLodInterval(int interval) { m_lowLodInterval = std::max(interval, 1); }
+
         //! Find the nearest point on the navigation mesh to a given point using the crowd initialized query extent and the specified query filter type.
         Vec3 findNearestPoint(const Vec3 &point, int queryFilterType, dtPolyRef *nearestRef = nullptr);
 
@@ -117,6 +129,21 @@ namespace ige::scene
         //! Find a path between world space points using the crowd initialized query extent and the specified query filter type. Return non-empty list of points if successful.
         void findPath(std::vector<Vec3> &dest, const Vec3 &start, const Vec3 &end, int queryFilterType);
 
+        //! Queue a time-sliced path query using the crowd initialized query extent and the specified query filter type. Return the ticket, 0 if rejected.
+        uint32_t requestPath(const Vec3 &start, const Vec3 &end, int queryFilterType, int priority = 0);
+
+        //! Cancel a queued or running path request
+        bool cancelPath(uint32_t ticket);
+
+        //! Return status of the path request
+        NavMesh::EPathStatus getPathStatus(uint32_t ticket) const;
+
+        //! Take the result of a finished path request, the ticket is released
+        bool getPathResult(uint32_t ticket, std::vector<Vec3> &dest);
+
+        //! Return the flow field toward the goal shared by agents of the query filter type, using the crowd initialized query extent.
+        std::shared_ptr<NavFlowField> getFlowField(const Vec3 &goal, int queryFilterType);
+
         //! Return a random point on the navigation mesh using the crowd initialized query extent and the specified query filter type.
         Vec3 getRandomPoint(int queryFilterType, dtPolyRef *randomRef = nullptr);
 
@@ -159,6 +186,18 @@ namespace ige::scene
         void onActivated(NavAgent *object);
         void onDeactivated(NavAgent *object);
 
+        //! Steer agents following flow fields with velocity requests, the crowd still resolves collisions
+        void updateFlowFieldAgents();
+
+        //! Classify agents by distance to the active camera and visibility
+        void updateAgentLods();
+
+        //! Update the crowd, low LOD agents sit out between their turns
+        void updateCrowd(float dt);
+
+        //! Write crowd positions to the agent owners in one pass
+        void writeBackPositions();
+
         //! Serialize
         virtual void to_json(json& j) const override;
 
@@ -192,5 +231,16 @@ namespace ige::scene
 
         //! Cache initialized status
         bool m_bInitialized = false;
+
+        //! Agents in the crowd, gathered once per update
+        std::vector<std::shared_ptr<NavAgent>> m_frameAgents;
+
+        //! Agent LOD
+        bool m_bLodEnabled = false;
+        Vec2 m_lodDistances = {30.f, 80.f};
+        int m_lowLodInterval = 4;
+
+        //! Frame counter staggering low LOD updates
+        uint32_t m_frameCount = 0;
     };
 } // namespace ige::scene
@@ -6,10 +6,24 @@
 #include "components/navigation/OffMeshLink.h"
 #include "components/navigation/NavAgentManager.h"
 #include "components/physic/collider/MeshCollider.h"
+#include "components/physic/collider/HeightfieldCollider.h"
+#include "components/physic/Rigidbody.h"
 #include "components/TransformComponent.h"
 #include "components/FigureComponent.h"
+#include "scene/Scene.h"
 #include "scene/SceneObject.h"
 #include "utils/ShapeDrawer.h"
+#include "utils/ThreadPool.h"
+#include "external/lz4/lz4.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <queue>
+#include <random>
+
+#include "utils/filesystem.h"
+namespace fs = ghc::filesystem;
 
 #define DEFAULT_TILE_SIZE 64
 #define DEFAULT_CELL_SIZE 0.3f
@@ -25,6 +39,11 @@
 #define DEFAULT_DETAIL_SAMPLE_DISTANCE 6.0f
 #define DEFAULT_DETAIL_SAMPLE_MAX_ERROR 1.0f
 
+#define NAV_BAKE_MAGIC 0x4B424E49 // "INBK"
+#define NAV_BAKE_VERSION 1
+
+#define PATH_RESULT_MAX_AGE 300 // Updates a finished path result waits for getPathResult()
+
 #ifndef INFINITY
     #include <limits>
     #define INFINITY std::numeric_limits<float>::max()
@@ -87,6 +106,166 @@ namespace ige::scene
         }
     }
 
+    //! Thread safe random in [0, 1] for Detour random queries
+    static float getRandomFloat()
+    {
+        thread_local std::minstd_rand engine(std::random_device{}());
+        return std::uniform_real_distribution<float>(0.f, 1.f)(engine);
+    }
+
+    //! Destructor
+    NavQueryContext::~NavQueryContext()
+    {
+        if (query)
+            dtFreeNavMeshQuery(query);
+        query = nullptr;
+    }
+
+    //! Return the node of the polygon, null if unreachable or not part of the field
+    const NavFlowField::Node *NavFlowField::getNode(const dtNavMesh *navMesh, dtPolyRef ref) const
+    {
+        if (!navMesh || !ref)
+            return nullptr;
+
+        unsigned int salt, it, ip;
+        navMesh->decodePolyId(ref, salt, it, ip);
+        if (it + 1 >= tileStarts.size() || tileSalts[it] != salt)
+            return nullptr;
+
+        const auto idx = tileStarts[it] + ip;
+        if (idx >= tileStarts[it + 1] || nodes[idx].cost == FLT_MAX)
+            return nullptr;
+        return &nodes[idx];
+    }
+
+    //! Point where the link leaves the polygon: edge midpoint, or the end point when either side is an off-mesh connection
+    static Vec3 getPortalPoint(dtPolyRef fromRef, const dtMeshTile *fromTile, const dtPoly *fromPoly, const dtLink &link, const dtMeshTile *toTile, const dtPoly *toPoly)
+    {
+        if (fromPoly->getType() == DT_POLYTYPE_OFFMESH_CONNECTION)
+        {
+            const auto v = &fromTile->verts[fromPoly->verts[link.edge] * 3];
+            return Vec3(v[0], v[1], v[2]);
+        }
+
+        if (toPoly->getType() == DT_POLYTYPE_OFFMESH_CONNECTION)
+        {
+            for (auto i = toPoly->firstLink; i != DT_NULL_LINK; i = toTile->links[i].next)
+            {
+                if (toTile->links[i].ref == fromRef)
+                {
+                    const auto v = &toTile->verts[toPoly->verts[toTile->links[i].edge] * 3];
+                    return Vec3(v[0], v[1], v[2]);
+                }
+            }
+        }
+
+        const auto va = &fromTile->verts[fromPoly->verts[link.edge] * 3];
+        const auto vb = &fromTile->verts[fromPoly->verts[(link.edge + 1) % fromPoly->vertCount] * 3];
+        auto tmin = 0.f, tmax = 1.f;
+
+        // Tile border links only cover part of the edge
+        if (link.side != 0xff && (link.bmin != 0 || link.bmax != 255))
+        {
+            tmin = link.bmin / 255.f;
+            tmax = link.bmax / 255.f;
+        }
+        const auto t = (tmin + tmax) * 0.5f;
+        return Vec3(va[0] + (vb[0] - va[0]) * t, va[1] + (vb[1] - va[1]) * t, va[2] + (vb[2] - va[2]) * t);
+    }
+
+    //! Build the grid index over the collected triangles
+    void NavTriMesh::buildIndex(float size)
+    {
+        cellStarts.clear();
+        cellTriangles.clear();
+        width = height = 0;
+        auto numTriangles = (int)(indices.size() / 3);
+        if (numTriangles == 0)
+            return;
+
+        float minX = INFINITY, minZ = INFINITY, maxX = -INFINITY, maxZ = -INFINITY;
+        for (const auto &v : vertices)
+        {
+            minX = std::min(minX, v[0]);
+            minZ = std::min(minZ, v[2]);
+            maxX = std::max(maxX, v[0]);
+            maxZ = std::max(maxZ, v[2]);
+        }
+
+        // Keep the grid bounded for huge or degenerate extents
+        const float maxCells = 1024.f;
+        cellSize = std::max({size, (maxX - minX) / maxCells, (maxZ - minZ) / maxCells, 0.001f});
+        originX = minX;
+        originZ = minZ;
+        width = (int)((maxX - minX) / cellSize) + 1;
+        height = (int)((maxZ - minZ) / cellSize) + 1;
+
+        auto forEachCell = [this](int tri, auto &&func) {
+            const auto &a = vertices[indices[tri * 3]];
+            const auto &b = vertices[indices[tri * 3 + 1]];
+            const auto &c = vertices[indices[tri * 3 + 2]];
+            int x0 = std::clamp((int)((std::min({a[0], b[0], c[0]}) - originX) / cellSize), 0, width - 1);
+            int x1 = std::clamp((int)((std::max({a[0], b[0], c[0]}) - originX) / cellSize), 0, width - 1);
+            int z0 = std::clamp((int)((std::min({a[2], b[2], c[2]}) - originZ) / cellSize), 0, height - 1);
+            int z1 = std::clamp((int)((std::max({a[2], b[2], c[2]}) - originZ) / cellSize), 0, height - 1);
+            for (int z = z0; z <= z1; ++z)
+                for (int x = x0; x <= x1; ++x)
+                    func(z * width + x);
+        };
+
+        // Count, then fill, so cells share one flat array
+        cellStarts.assign(width * height + 1, 0);
+        for (int tri = 0; tri < numTriangles; ++tri)
+            forEachCell(tri, [this](int cell) { ++cellStarts[cell + 1]; });
+        for (size_t i = 1; i < cellStarts.size(); ++i)
+            cellStarts[i] += cellStarts[i - 1];
+
+        cellTriangles.resize(cellStarts.back());
+        std::vector<int> fill(cellStarts.begin(), cellStarts.end() - 1);
+        for (int tri = 0; tri < numTriangles; ++tri)
+            forEachCell(tri, [this, &fill, tri](int cell) { cellTriangles[fill[cell]++] = tri; });
+    }
+
+    //! Append triangles overlapping the box on XZ to the tile geometry
+    void NavTriMesh::query(const AABBox &box, std::vector<std::array<float, 3>> &outVertices, std::vector<int> &outIndices) const
+    {
+        if (width == 0 || height == 0)
+            return;
+
+        int x0 = (int)std::floor((box.MinEdge.X() - originX) / cellSize);
+        int x1 = (int)std::floor((box.MaxEdge.X() - originX) / cellSize);
+        int z0 = (int)std::floor((box.MinEdge.Z() - originZ) / cellSize);
+        int z1 = (int)std::floor((box.MaxEdge.Z() - originZ) / cellSize);
+        if (x1 < 0 || z1 < 0 || x0 >= width || z0 >= height)
+            return;
+        x0 = std::max(x0, 0); z0 = std::max(z0, 0);
+        x1 = std::min(x1, width - 1); z1 = std::min(z1, height - 1);
+
+        // Triangles spanning several cells are listed once per cell
+        std::vector<int> triangles;
+        for (int z = z0; z <= z1; ++z)
+            for (int x = x0; x <= x1; ++x)
+                triangles.insert(triangles.end(), cellTriangles.begin() + cellStarts[z * width + x], cellTriangles.begin() + cellStarts[z * width + x + 1]);
+        std::sort(triangles.begin(), triangles.end());
+        triangles.erase(std::unique(triangles.begin(), triangles.end()), triangles.end());
+
+        for (auto tri : triangles)
+        {
+            const auto &a = vertices[indices[tri * 3]];
+            const auto &b = vertices[indices[tri * 3 + 1]];
+            const auto &c = vertices[indices[tri * 3 + 2]];
+            if (std::max({a[0], b[0], c[0]}) < box.MinEdge.X() || std::min({a[0], b[0], c[0]}) > box.MaxEdge.X() ||
+                std::max({a[2], b[2], c[2]}) < box.MinEdge.Z() || std::min({a[2], b[2], c[2]}) > box.MaxEdge.Z())
+                continue;
+
+            auto start = (int)outVertices.size();
+            outVertices.push_back(a);
+            outVertices.push_back(b);
+            outVertices.push_back(c);
+            outIndices.insert(outIndices.end(), {start, start + 1, start + 2});
+        }
+    }
+
     //! Constructor
     NavMesh::NavMesh(SceneObject& owner)
         : Component(owner),
@@ -105,7 +284,6 @@ namespace ige::scene
           m_detailSampleMaxError(DEFAULT_DETAIL_SAMPLE_MAX_ERROR),
           m_partitionType(EPartitionType::WATERSHED)
     {
-        m_pathData = std::make_unique<FindPathData>();
 
         // Create navigation agent manager for this mesh
         m_navAgentManager = getOwner()->getRoot()->getComponent<NavAgentManager>();
@@ -119,15 +297,21 @@ namespace ige::scene
 
         m_navMesh = nullptr;
         m_navMeshQuery = nullptr;
-        m_pathData.reset();
+        m_queryPool.clear();
         m_navAgentManager.reset();
     }
 
     void NavMesh::releaseNavMesh()
     {
+        cancelAsyncBuild();
+
         if (!m_navAgentManager.expired())
             m_navAgentManager.lock()->deactivateAllAgents();
 
+        std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+        ++m_navMeshVersion;
+        m_polyTable.clear();
+
         if (m_navMesh)
         {
             dtFreeNavMesh(m_navMesh);
@@ -140,6 +324,14 @@ namespace ige::scene
             m_navMeshQuery = nullptr;
         }
 
+        // Pending path requests restart on the next navigation mesh
+        if (m_slicedQuery)
+        {
+            dtFreeNavMeshQuery(m_slicedQuery);
+            m_slicedQuery = nullptr;
+        }
+        m_slicedQueryMesh = nullptr;
+
         m_numTilesX = 0;
         m_numTilesZ = 0;
         m_boundingBox.reset({ Vec3(INFINITY, INFINITY, INFINITY), Vec3(-INFINITY, -INFINITY, -INFINITY) });
@@ -165,6 +357,7 @@ namespace ige::scene
         collectGeometries(geometryList);
         if (geometryList.empty())
             return true;
+        m_geometryHash = computeGeometryHash(geometryList);
 
         // Extend bounding box
         for (size_t i = 0; i < geometryList.size(); ++i)
@@ -199,12 +392,8 @@ namespace ige::scene
             params.maxPolys = maxPolys;
 
             // Allocate nav mesh
-            m_navMesh = dtAllocNavMesh();
-            if (!m_navMesh)
-                return false;
-
-            // Initialize nav mesh
-            if (dtStatusFailed(m_navMesh->init(&params)))
+            // Allocate and initialize nav mesh
+            if (!createNavMesh(params))
             {
                 releaseNavMesh();
                 return false;
@@ -224,20 +413,29 @@ namespace ige::scene
         if (!m_navMesh)
             return false;
 
+        std::vector<NavGeoInfo> geometryList;
+        collectGeometries(geometryList);
+
+        Vec2 from, to;
+        getTileRange(boundingBox, from, to);
+        auto numTiles = buildTiles(geometryList, from, to);
+        m_geometryHash = computeGeometryHash(geometryList);
+        return true;
+    }
+
+    //! Tile range touched by the world-space bounding box
+    void NavMesh::getTileRange(const AABBox &boundingBox, Vec2 &from, Vec2 &to) const
+    {
         auto inverse = getOwner()->getTransform()->getWorldMatrix().Inverse();
         auto localSpaceBox = boundingBox.Transform(inverse);
         auto tileEdgeLength = m_tileSize * m_cellSize;
 
-        std::vector<NavGeoInfo> geometryList;
-        collectGeometries(geometryList);
-
         int sx = std::clamp((int)((localSpaceBox.MinEdge.X() - m_boundingBox.MinEdge.X()) / tileEdgeLength), 0, m_numTilesX - 1);
         int sz = std::clamp((int)((localSpaceBox.MinEdge.Z() - m_boundingBox.MinEdge.Z()) / tileEdgeLength), 0, m_numTilesZ - 1);
         int ex = std::clamp((int)((localSpaceBox.MaxEdge.X() - m_boundingBox.MinEdge.X()) / tileEdgeLength), 0, m_numTilesX - 1);
         int ez = std::clamp((int)((localSpaceBox.MaxEdge.Z() - m_boundingBox.MinEdge.Z()) / tileEdgeLength), 0, m_numTilesZ - 1);
-
-        auto numTiles = buildTiles(geometryList, Vec2(sx, sz), Vec2(ex, ez));
-        return true;
+        from = Vec2(sx, sz);
+        to = Vec2(ex, ez);
     }
 
     //! Rebuild part of the navigation mesh in the rectangular area
@@ -246,6 +444,7 @@ namespace ige::scene
         std::vector<NavGeoInfo> geometryList;
         collectGeometries(geometryList);
         auto numTiles = buildTiles(geometryList, from, to);
+        m_geometryHash = computeGeometryHash(geometryList);
         return true;
     }
 
@@ -319,9 +518,25 @@ namespace ige::scene
 
         processedNodes.insert(node);
 
-        // Get figure component
+        // Prefer heightfield over the figure, only the cells inside a tile are added
+        auto heightfield = node->getComponent<HeightfieldCollider>();
         auto figure = node->getComponent<FigureComponent>();
-        if (figure && figure->isEnabled() && !figure->isSkipSerialize())
+        auto body = heightfield ? node->getComponent<Rigidbody>() : nullptr;
+        if (body && body->getMass() > 0.f && !body->isKinematic())
+        {
+            // A simulated terrain moves away from the baked surface, it is not walkable geometry
+            pyxie_printf("[NavMesh] Skip dynamic heightfield '%s'\n", node->getName().c_str());
+        }
+        else if (heightfield && heightfield->isEnabled() && heightfield->getWidth() > 0)
+        {
+            NavGeoInfo info;
+            info.component = heightfield.get();
+            info.transform = Mat4::IdentityMat();
+            info.boundingBox = heightfield->getLocalBoundingBox().Transform(node->getTransform()->getWorldMatrix());
+            geometryList.push_back(info);
+        }
+        // Get figure component
+        else if (figure && figure->isEnabled() && !figure->isSkipSerialize())
         {
             NavGeoInfo info;
             info.component = figure.get();
@@ -341,7 +556,7 @@ namespace ige::scene
     }
 
     //! Get geometry data within a bounding box
-    void NavMesh::getTileGeometry(NavBuildData *build, std::vector<NavGeoInfo> &geometryList, AABBox &box)
+    void NavMesh::getTileGeometry(NavBuildData *build, std::vector<NavGeoInfo> &geometryList, const NavTriMesh &triMesh, AABBox &box)
     {
         auto inverse = getOwner()->getTransform()->getWorldMatrix().Inverse();
 
@@ -349,8 +564,6 @@ namespace ige::scene
         {
             if (box.IsPartiallyInside(geometryList[i].boundingBox))
             {
-                const auto &transform = geometryList[i].transform;
-
                 if (geometryList[i].component->getName() == "OffMeshLink")
                 {
                     auto *link = static_cast<OffMeshLink *>(geometryList[i].component);
@@ -374,15 +587,212 @@ namespace ige::scene
                     continue;
                 }
 
-                auto figure = dynamic_cast<FigureComponent *>(geometryList[i].component);
-                if (figure && figure->getFigure())
-                    addTriMeshGeometry(build, figure->getFigure(), transform);
+                else if (geometryList[i].component->getName() == "HeightfieldCollider")
+                {
+                    addHeightfieldGeometry(build, static_cast<HeightfieldCollider *>(geometryList[i].component), box);
+                    continue;
+                }
+            }
+        }
+
+        // Figure triangles overlapping the tile
+        triMesh.query(box, build->vertices, build->indices);
+    }
+
+    //! Collect figure triangles of the geometry overlapping the bounds and index them
+    void NavMesh::buildTriMesh(std::vector<NavGeoInfo> &geometryList, const AABBox &bounds, NavTriMesh &triMesh)
+    {
+        for (size_t i = 0; i < geometryList.size(); ++i)
+        {
+            // Figures outside the rebuilt tiles on XZ are never queried, skip reading their meshes
+            const auto &box = geometryList[i].boundingBox;
+            if (box.MaxEdge.X() < bounds.MinEdge.X() || box.MinEdge.X() > bounds.MaxEdge.X()
+                || box.MaxEdge.Z() < bounds.MinEdge.Z() || box.MinEdge.Z() > bounds.MaxEdge.Z())
+                continue;
+            auto figure = dynamic_cast<FigureComponent *>(geometryList[i].component);
+            if (figure && figure->getFigure())
+                addTriMeshGeometry(triMesh, figure->getFigure(), geometryList[i].transform);
+        }
+        triMesh.buildIndex((float)m_tileSize * m_cellSize);
+    }
+
+    //! FNV-1a hash helper
+    uint64_t NavMesh::hashBytes(uint64_t hash, const void *data, size_t size)
+    {
+        auto bytes = (const uint8_t *)data;
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    //! Hash build settings and collected geometry, including figure vertex and index data
+    uint64_t NavMesh::computeGeometryHash(const std::vector<NavGeoInfo> &geometryList) const
+    {
+        uint64_t hash = 14695981039346656037ull;
+        auto add = [&hash](const void *data, size_t size) { hash = hashBytes(hash, data, size); };
+
+        // Build settings
+        float settings[] = {m_cellSize, m_cellHeight, m_agentHeight, m_agentRadius, m_agentMaxClimb, m_agentMaxSlope, m_regionMinSize,
+                            m_regionMergeSize, m_edgeMaxLength, m_edgeMaxError, m_detailSampleDistance, m_detailSampleMaxError};
+        add(settings, sizeof(settings));
+        add(m_padding.P(), sizeof(float) * 3);
+        add(&m_tileSize, sizeof(m_tileSize));
+        add(&m_partitionType, sizeof(m_partitionType));
+        add(getOwner()->getTransform()->getWorldMatrix().P(), sizeof(float) * 16);
+
+        for (const auto &info : geometryList)
+        {
+            const auto &name = info.component->getName();
+            add(name.data(), name.size());
+            add(info.boundingBox.MinEdge.P(), sizeof(float) * 3);
+            add(info.boundingBox.MaxEdge.P(), sizeof(float) * 3);
+
+            if (name == "OffMeshLink")
+            {
+                auto link = static_cast<OffMeshLink *>(info.component);
+                uint32_t values[] = {link->getMask(), link->getAreaId(), link->isBidirectional() ? 1u : 0u};
+                float radius = link->getRadius();
+                add(link->getOwner()->getTransform()->getPosition().P(), sizeof(float) * 3);
+                if (auto endPoint = link->getEndPoint())
+                    add(endPoint->getTransform()->getPosition().P(), sizeof(float) * 3);
+                add(values, sizeof(values));
+                add(&radius, sizeof(radius));
+            }
+            else if (name == "NavArea")
+            {
+                int areaId = static_cast<NavArea *>(info.component)->getAreaId();
+                add(&areaId, sizeof(areaId));
+            }
+            else if (name == "HeightfieldCollider")
+            {
+                auto heightfield = static_cast<HeightfieldCollider *>(info.component);
+                const auto &heights = heightfield->getHeights();
+                add(heights.data(), heights.size() * sizeof(int16_t));
+                add(heightfield->getOwner()->getTransform()->getWorldMatrix().P(), sizeof(float) * 16);
+            }
+            else if (auto figureComp = dynamic_cast<FigureComponent *>(info.component))
+            {
+                const auto &path = figureComp->getPath();
+                add(path.data(), path.size());
+                add(figureComp->getOwner()->getTransform()->getWorldMatrix().P(), sizeof(float) * 16);
+                if (auto figure = figureComp->getFigure())
+                {
+                    for (int i = 0; i < figure->NumMeshes(); ++i)
+                    {
+                        auto mesh = figure->GetMesh(i);
+                        int counts[] = {mesh->numVerticies, mesh->numIndices};
+                        add(counts, sizeof(counts));
+                        if (mesh->vertices && mesh->numVerticies > 0)
+                            add(mesh->vertices, (size_t)mesh->numVerticies * mesh->vertexFormatSize);
+                        if (mesh->indices && mesh->numIndices > 0)
+                            add(mesh->indices, (size_t)mesh->numIndices * sizeof(mesh->indices[0]));
+                    }
+                }
             }
         }
+        return hash;
+    }
+
+    //! Path of the baked data file: <scene>_<object uuid>.nav
+    std::string NavMesh::getBakedDataPath() const
+    {
+        auto scene = getOwner()->getScene();
+        if (!scene || scene->isPrefab() || scene->getPath().empty())
+            return {};
+        auto path = fs::path(scene->getPath()).replace_extension("");
+        return path.string() + "_" + getOwner()->getUUID() + ".nav";
+    }
+
+    //! Save baked tiles, skipped when the same data was already saved to the same path
+    bool NavMesh::saveBakedData()
+    {
+        auto path = getBakedDataPath();
+        if (!m_bBakeEnabled || path.empty() || !m_navMesh)
+            return false;
+        if (m_geometryHash == m_savedHash && path == m_savedPath && fs::exists(path))
+            return true;
+
+        auto buffer = getNavDataAttr();
+        if (buffer.empty())
+            return false;
+
+        auto rawSize = (uint32_t)buffer.size();
+        std::vector<char> compressed(LZ4_compressBound((int)rawSize));
+        auto compressedSize = LZ4_compress_default((const char *)buffer.data(), compressed.data(), (int)rawSize, (int)compressed.size());
+        if (compressedSize <= 0)
+            return false;
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open())
+            return false;
+        uint32_t header[] = {NAV_BAKE_MAGIC, NAV_BAKE_VERSION, rawSize, (uint32_t)compressedSize};
+        file.write((const char *)header, sizeof(header));
+        file.write((const char *)&m_geometryHash, sizeof(m_geometryHash));
+        file.write(compressed.data(), compressedSize);
+        if (!file.good())
+            return false;
+        m_savedHash = m_geometryHash;
+        m_savedPath = path;
+        return true;
+    }
+
+    //! Load baked tiles if the stored hash matches the current geometry
+    bool NavMesh::loadBakedData()
+    {
+        if (!isEnabled() || !m_bBakeEnabled || m_navAgentManager.expired())
+            return false;
+
+        auto path = getBakedDataPath();
+        if (path.empty() || !fs::exists(path))
+            return false;
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+            return false;
+
+        uint32_t header[4] = {};
+        uint64_t hash = 0;
+        file.read((char *)header, sizeof(header));
+        file.read((char *)&hash, sizeof(hash));
+        if (!file.good() || header[0] != NAV_BAKE_MAGIC || header[1] != NAV_BAKE_VERSION)
+            return false;
+
+        // Rebuild when settings or geometry changed
+        std::vector<NavGeoInfo> geometryList;
+        collectGeometries(geometryList);
+        if (geometryList.empty() || hash != computeGeometryHash(geometryList))
+            return false;
+
+        std::vector<char> compressed(header[3]);
+        file.read(compressed.data(), compressed.size());
+        if (!file.good())
+            return false;
+
+        std::vector<char> raw(header[2]);
+        if (LZ4_decompress_safe(compressed.data(), raw.data(), (int)compressed.size(), (int)raw.size()) != (int)raw.size())
+            return false;
+
+        MemBuffer buffer;
+        buffer.write(raw.data(), (unsigned long)raw.size());
+        buffer.seek(0);
+
+        m_navAgentManager.lock()->deactivateAllAgents();
+        setNavDataAttr(buffer);
+        if (!m_navMesh)
+            return false;
+
+        m_geometryHash = m_savedHash = hash;
+        m_savedPath = path;
+        onNavDataLoaded();
+        m_navAgentManager.lock()->reactivateAllAgents();
+        return true;
     }
 
     //! Add a triangle mesh to the geometry data.
-    void NavMesh::addTriMeshGeometry(NavBuildData *build, Figure *figure, const Mat4 &transform)
+    void NavMesh::addTriMeshGeometry(NavTriMesh &triMesh, Figure *figure, const Mat4 &transform)
     {
         if (!figure)
             return;
@@ -407,10 +817,10 @@ namespace ige::scene
                 figure->AllocTransformBuffer(space, palettebuffer, inbindSkinningMatrices);
                 figure->ReadPositions(i, 0, mesh->numVerticies, space, palettebuffer, inbindSkinningMatrices, &positions);
 
-                auto destVertexStart = build->vertices.size();
+                auto destVertexStart = triMesh.vertices.size();
                 for (const auto& pos : positions)
                 {
-                    build->vertices.push_back({ pos[0], pos[1], pos[2] });
+                    triMesh.vertices.push_back({ pos[0], pos[1], pos[2] });
                 }
                 positions.clear();
 
@@ -423,20 +833,69 @@ namespace ige::scene
                 for (int k = 0; k < mesh->numIndices; ++k)
                 {
                     if (mesh->numVerticies > 65535)
-                        build->indices.push_back(((uint32_t*)mesh->indices)[k] + destVertexStart);
+                        triMesh.indices.push_back(((uint32_t*)mesh->indices)[k] + destVertexStart);
                     else
-                        build->indices.push_back(mesh->indices[k] + destVertexStart);
+                        triMesh.indices.push_back(mesh->indices[k] + destVertexStart);
                 }
             }
         }
     }
 
-    //! Build one tile of the navigation mesh
-    bool NavMesh::buildTile(std::vector<NavGeoInfo> &geometryList, int x, int z)
+    //! Add heightfield cells overlapping the bounding box to the geometry data.
+    void NavMesh::addHeightfieldGeometry(NavBuildData *build, HeightfieldCollider *heightfield, const AABBox &box)
+    {
+        auto width = heightfield->getWidth();
+        auto length = heightfield->getLength();
+        if (width < 2 || length < 2)
+            return;
+
+        // Find the cells covered by the box in the grid space
+        const auto &worldMatrix = heightfield->getOwner()->getTransform()->getWorldMatrix();
+        auto localBox = box.Transform(worldMatrix.Inverse());
+        const auto &scale = heightfield->getScale();
+        const auto &origin = heightfield->getOrigin();
+        const auto &spacing = heightfield->getSpacing();
+        auto x0 = (localBox.MinEdge.X() / scale.X() - origin.X()) / spacing.X();
+        auto x1 = (localBox.MaxEdge.X() / scale.X() - origin.X()) / spacing.X();
+        auto z0 = (localBox.MinEdge.Z() / scale.Z() - origin.Y()) / spacing.Y();
+        auto z1 = (localBox.MaxEdge.Z() / scale.Z() - origin.Y()) / spacing.Y();
+        int sx = std::clamp((int)std::floor(std::min(x0, x1)), 0, width - 1);
+        int ex = std::clamp((int)std::ceil(std::max(x0, x1)), 0, width - 1);
+        int sz = std::clamp((int)std::floor(std::min(z0, z1)), 0, length - 1);
+        int ez = std::clamp((int)std::ceil(std::max(z0, z1)), 0, length - 1);
+        if (sx >= ex || sz >= ez)
+            return;
+
+        auto destVertexStart = (int)build->vertices.size();
+        for (int z = sz; z <= ez; ++z)
+        {
+            for (int x = sx; x <= ex; ++x)
+            {
+                auto pos = worldMatrix * heightfield->getLocalPoint(x, z);
+                build->vertices.push_back({ pos[0], pos[1], pos[2] });
+            }
+        }
+
+        // Split cells along the (x, z + 1) - (x + 1, z) diagonal, the default btHeightfieldTerrainShape split.
+        // HeightfieldCollider creates its shape without flipped, diamond or zigzag subdivision.
+        auto rowSize = ex - sx + 1;
+        for (int z = 0; z < ez - sz; ++z)
+        {
+            for (int x = 0; x < ex - sx; ++x)
+            {
+                auto v00 = destVertexStart + z * rowSize + x;
+                auto v10 = v00 + 1;
+                auto v01 = v00 + rowSize;
+                auto v11 = v01 + 1;
+                build->indices.insert(build->indices.end(), { v00, v01, v10, v01, v11, v10 });
+            }
+        }
+    }
+
+    //! Recast config of the tile, bounds include the border
+    rcConfig NavMesh::getTileConfig(int x, int z) const
     {
-        m_navMesh->removeTile(m_navMesh->getTileRefAt(x, z, 0), nullptr, nullptr);
         const auto &tileBoundingBox = getTileBoundingBox(Vec2(x, z));
-        SimpleNavBuildData build;
 
         rcConfig cfg;
         memset(&cfg, 0, sizeof cfg);
@@ -464,10 +923,29 @@ namespace ige::scene
         cfg.bmin[2] -= cfg.borderSize * cfg.cs;
         cfg.bmax[0] += cfg.borderSize * cfg.cs;
         cfg.bmax[2] += cfg.borderSize * cfg.cs;
+        return cfg;
+    }
+
+    //! Bounds of the tile range, including the tile border
+    AABBox NavMesh::getTileRangeBounds(const Vec2 &from, const Vec2 &to) const
+    {
+        auto fromConfig = getTileConfig((int)from.X(), (int)from.Y());
+        auto toConfig = getTileConfig((int)to.X(), (int)to.Y());
+        return AABBox(*reinterpret_cast<const Vec3 *>(fromConfig.bmin), *reinterpret_cast<const Vec3 *>(toConfig.bmax));
+    }
 
-        auto expandedBox = AABBox(*reinterpret_cast<Vec3 *>(cfg.bmin), *reinterpret_cast<Vec3 *>(cfg.bmax));
-        getTileGeometry(&build, geometryList, expandedBox);
+    //! Collect geometry of the tile, on the calling thread since figures and transforms are not thread safe
+    void NavMesh::getTileGeometry(NavBuildData *build, std::vector<NavGeoInfo> &geometryList, const NavTriMesh &triMesh, const rcConfig &cfg)
+    {
+        auto expandedBox = AABBox(*reinterpret_cast<const Vec3 *>(cfg.bmin), *reinterpret_cast<const Vec3 *>(cfg.bmax));
+        getTileGeometry(build, geometryList, triMesh, expandedBox);
+    }
 
+    //! Run the Recast pipeline on the collected tile geometry. Only touches the build data, safe to run on worker threads.
+    bool NavMesh::buildTileData(SimpleNavBuildData &build, const rcConfig &cfg, int x, int z, uint8_t *&navData, int &navDataSize) const
+    {
+        navData = nullptr;
+        navDataSize = 0;
         if (build.vertices.empty() || build.indices.empty())
             return true;
 
@@ -479,11 +957,10 @@ namespace ige::scene
             return false;
 
         auto numTriangles = build.indices.size() / 3;
-        auto triAreas = new uint8_t[numTriangles];
-        memset(triAreas, 0, numTriangles);
+        std::vector<uint8_t> triAreas(numTriangles, 0);
 
-        rcMarkWalkableTriangles(build.ctx, cfg.walkableSlopeAngle, &(build.vertices[0][0]), build.vertices.size(), &build.indices[0], numTriangles, triAreas);
-        rcRasterizeTriangles(build.ctx, &(build.vertices[0][0]), build.vertices.size(), &build.indices[0], triAreas, numTriangles, *build.heightField, cfg.walkableClimb);
+        rcMarkWalkableTriangles(build.ctx, cfg.walkableSlopeAngle, &(build.vertices[0][0]), build.vertices.size(), &build.indices[0], numTriangles, triAreas.data());
+        rcRasterizeTriangles(build.ctx, &(build.vertices[0][0]), build.vertices.size(), &build.indices[0], triAreas.data(), numTriangles, *build.heightField, cfg.walkableClimb);
         rcFilterLowHangingWalkableObstacles(build.ctx, cfg.walkableClimb, *build.heightField);
 
         rcFilterWalkableLowHeightSpans(build.ctx, cfg.walkableHeight, *build.heightField);
@@ -545,9 +1022,6 @@ namespace ige::scene
                 build.polyMesh->flags[i] = 0x1;
         }
 
-        uint8_t *navData = nullptr;
-        int navDataSize = 0;
-
         dtNavMeshCreateParams params;
         memset(&params, 0, sizeof params);
         params.verts = build.polyMesh->verts;
@@ -584,28 +1058,181 @@ namespace ige::scene
             params.offMeshConDir = &build.offMeshDir[0];
         }
 
-        if (!dtCreateNavMeshData(&params, &navData, &navDataSize))
-            return false;
+        return dtCreateNavMeshData(&params, &navData, &navDataSize);
+    }
 
-        if (dtStatusFailed(m_navMesh->addTile(navData, navDataSize, DT_TILE_FREE_DATA, 0, nullptr)))
-            return false;
+    //! SimpleNavTileJob: tile build data and the resulting Detour tile
+    struct SimpleNavTileJob : public NavTileJob
+    {
+        //! Destructor, frees the tile if it was not added to the navigation mesh
+        ~SimpleNavTileJob() override
+        {
+            if (navData)
+                dtFree(navData);
+        }
 
-        return true;
+        //! Build data
+        SimpleNavBuildData build;
+
+        //! Detour tile data
+        uint8_t *navData = nullptr;
+        int navDataSize = 0;
+
+        //! Build result
+        bool success = false;
+    };
+
+    //! Gather geometry of the tile into a build job
+    std::unique_ptr<NavTileJob> NavMesh::createTileJob(std::vector<NavGeoInfo> &geometryList, const NavTriMesh &triMesh, int x, int z)
+    {
+        auto job = std::make_unique<SimpleNavTileJob>();
+        job->x = x;
+        job->z = z;
+        job->cfg = getTileConfig(x, z);
+        getTileGeometry(&job->build, geometryList, triMesh, job->cfg);
+        return job;
+    }
+
+    //! Build the job
+    void NavMesh::runTileJob(NavTileJob &job) const
+    {
+        auto &tileJob = static_cast<SimpleNavTileJob &>(job);
+        tileJob.success = buildTileData(tileJob.build, tileJob.cfg, tileJob.x, tileJob.z, tileJob.navData, tileJob.navDataSize);
+    }
+
+    //! Replace the tile with the job result
+    uint32_t NavMesh::commitTileJob(NavTileJob &job)
+    {
+        auto &tileJob = static_cast<SimpleNavTileJob &>(job);
+        m_navMesh->removeTile(m_navMesh->getTileRefAt(tileJob.x, tileJob.z, 0), nullptr, nullptr);
+        if (!tileJob.success)
+            return 0;
+        if (tileJob.navData)
+        {
+            if (dtStatusFailed(m_navMesh->addTile(tileJob.navData, tileJob.navDataSize, DT_TILE_FREE_DATA, 0, nullptr)))
+                return 0;
+            tileJob.navData = nullptr; // Owned by the navigation mesh
+        }
+        return 1;
     }
 
     //! Build tiles in the rectangular area. Return number of built tiles.
+    //! Geometry is gathered per batch on the calling thread, Recast runs on the thread pool, tiles are added back here.
     uint32_t NavMesh::buildTiles(std::vector<NavGeoInfo> &geometryList, const Vec2 &from, const Vec2 &to)
     {
-        uint32_t numTiles = 0;
+        std::vector<std::pair<int, int>> coords;
         for (int z = from.Y(); z <= to.Y(); ++z)
-        {
             for (int x = from.X(); x <= to.X(); ++x)
+                coords.push_back({x, z});
+
+        // Bound the memory held by pending build data
+        const int batchSize = (ThreadPool::getInstance()->getNumThreads() + 1) * 4;
+
+        // Figure triangles are read and transformed once, tiles only copy the triangles they overlap
+        NavTriMesh triMesh;
+        buildTriMesh(geometryList, getTileRangeBounds(from, to), triMesh);
+
+        uint32_t numTiles = 0;
+        std::vector<std::unique_ptr<NavTileJob>> jobs;
+        for (size_t first = 0; first < coords.size(); first += batchSize)
+        {
+            auto count = std::min(coords.size() - first, (size_t)batchSize);
+            jobs.clear();
+            for (size_t i = 0; i < count; ++i)
+                jobs.push_back(createTileJob(geometryList, triMesh, coords[first + i].first, coords[first + i].second));
+
+            ThreadPool::getInstance()->parallelFor((int)count, [this, &jobs](int begin, int end) {
+                for (int i = begin; i < end; ++i)
+                    runTileJob(*jobs[i]);
+            });
+
+            std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+            ++m_navMeshVersion;
+            for (auto &job : jobs)
+                numTiles += commitTileJob(*job);
+
+            // Apply area flag overrides before the new tiles are queried
+            updatePolyTable();
+        }
+        return numTiles;
+    }
+
+    //! Queue a rebuild of tiles touched by the world-space bounding box
+    void NavMesh::buildAsync(const AABBox &boundingBox)
+    {
+        if (!m_navMesh)
+            return;
+
+        Vec2 from, to;
+        getTileRange(boundingBox, from, to);
+        buildAsync(from, to);
+    }
+
+    //! Queue a rebuild of tiles in the rectangular area
+    void NavMesh::buildAsync(const Vec2 &from, const Vec2 &to)
+    {
+        if (!m_navMesh)
+            return;
+
+        for (int z = std::max((int)from.Y(), 0); z <= std::min((int)to.Y(), m_numTilesZ - 1); ++z)
+            for (int x = std::max((int)from.X(), 0); x <= std::min((int)to.X(), m_numTilesX - 1); ++x)
+                m_dirtyTiles.insert({x, z});
+    }
+
+    //! Swap in finished async tiles, then start the next queued rebuild
+    void NavMesh::updateAsyncBuild()
+    {
+        if (m_asyncBuild.valid())
+        {
+            if (m_asyncBuild.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return;
+
+            m_asyncBuild.get();
             {
-                if (buildTile(geometryList, x, z))
-                    ++numTiles;
+                std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+                ++m_navMeshVersion;
+                for (auto &job : m_asyncJobs)
+                    commitTileJob(*job);
+                updatePolyTable();
             }
+            m_asyncJobs.clear();
         }
-        return numTiles;
+
+        if (m_dirtyTiles.empty() || !m_navMesh)
+            return;
+
+        // Snapshot geometry of the dirty tiles, requests made while building are queued for the next round
+        std::vector<NavGeoInfo> geometryList;
+        collectGeometries(geometryList);
+        auto from = Vec2((float)m_dirtyTiles.begin()->first, (float)m_dirtyTiles.begin()->second), to = from;
+        for (const auto &tile : m_dirtyTiles)
+        {
+            from = Vec2(std::min(from.X(), (float)tile.first), std::min(from.Y(), (float)tile.second));
+            to = Vec2(std::max(to.X(), (float)tile.first), std::max(to.Y(), (float)tile.second));
+        }
+        NavTriMesh triMesh;
+        buildTriMesh(geometryList, getTileRangeBounds(from, to), triMesh);
+        for (const auto &tile : m_dirtyTiles)
+            m_asyncJobs.push_back(createTileJob(geometryList, triMesh, tile.first, tile.second));
+        m_dirtyTiles.clear();
+        m_geometryHash = computeGeometryHash(geometryList);
+
+        m_asyncBuild = ThreadPool::getInstance()->enqueue([this]() {
+            ThreadPool::getInstance()->parallelFor((int)m_asyncJobs.size(), [this](int begin, int end) {
+                for (int i = begin; i < end; ++i)
+                    runTileJob(*m_asyncJobs[i]);
+            });
+        });
+    }
+
+    //! Wait for the running async rebuild and drop its results
+    void NavMesh::cancelAsyncBuild()
+    {
+        if (m_asyncBuild.valid())
+            m_asyncBuild.wait();
+        m_asyncBuild = {};
+        m_asyncJobs.clear();
+        m_dirtyTiles.clear();
     }
 
     //! Return tile data.
@@ -647,6 +1274,8 @@ namespace ige::scene
             return false;
         source.read(navData, navDataSize);
 
+        std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+        ++m_navMeshVersion;
         if (dtStatusFailed(m_navMesh->addTile(navData, navDataSize, DT_TILE_FREE_DATA, 0, nullptr)))
         {
             dtFree(navData);
@@ -658,7 +1287,13 @@ namespace ige::scene
     //! Add tile to navigation mesh.
     bool NavMesh::addTile(MemBuffer &tileData)
     {
-        return readTile(tileData);
+        if (!readTile(tileData))
+            return false;
+
+        // Apply area flag overrides before the tile is queried
+        std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+        updatePolyTable();
+        return true;
     }
 
     //! Remove tile from navigation mesh
@@ -667,6 +1302,8 @@ namespace ige::scene
         if (!m_navMesh)
             return;
 
+        std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+        ++m_navMeshVersion;
         const dtTileRef tileRef = m_navMesh->getTileRefAt(tile.X(), tile.Y(), 0);
         if (!tileRef)
             return;
@@ -677,6 +1314,8 @@ namespace ige::scene
     //! Remove all tiles from navigation mesh
     void NavMesh::removeAllTiles()
     {
+        std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+        ++m_navMeshVersion;
         for (int i = 0; i < m_navMesh->getMaxTiles(); ++i)
         {
             const auto tile = static_cast<const dtNavMesh *>(m_navMesh)->getTile(i);
@@ -720,7 +1359,9 @@ namespace ige::scene
     //! Try to move along the surface from one point to another
     Vec3 NavMesh::moveAlongSurface(const Vec3 &start, const Vec3 &end, const Vec3 &extents, int maxVisited, const dtQueryFilter *filter)
     {
-        if (!filter || !initializeQuery())
+        std::shared_lock<std::shared_mutex> lock(m_navMeshMutex);
+        auto context = acquireQuery();
+        if (!filter || !context)
             return end;
 
         const auto &transform = getOwner()->getTransform()->getWorldMatrix();
@@ -730,7 +1371,7 @@ namespace ige::scene
         auto localEnd = inverse * end;
 
         dtPolyRef startRef;
-        m_navMeshQuery->findNearestPoly(localStart.P(), extents.P(), filter, &startRef, nullptr);
+        context->query->findNearestPoly(localStart.P(), extents.P(), filter, &startRef, nullptr);
         if (!startRef)
             return end;
 
@@ -738,14 +1379,16 @@ namespace ige::scene
         int visitedCount = 0;
         maxVisited = Max(maxVisited, 0);
         std::vector<dtPolyRef> visited((uint32_t)maxVisited);
-        m_navMeshQuery->moveAlongSurface(startRef, localStart.P(), localEnd.P(), filter, resultPos.P(), maxVisited ? &visited[0] : nullptr, &visitedCount, maxVisited);
+        context->query->moveAlongSurface(startRef, localStart.P(), localEnd.P(), filter, resultPos.P(), maxVisited ? &visited[0] : nullptr, &visitedCount, maxVisited);
         return transform * resultPos;
     }
 
     //! Find the nearest point on the navigation mesh to a given
     Vec3 NavMesh::findNearestPoint(const Vec3 &point, const Vec3 &extents, const dtQueryFilter *filter, dtPolyRef *nearestRef)
     {
-        if (!filter || !initializeQuery())
+        std::shared_lock<std::shared_mutex> lock(m_navMeshMutex);
+        auto context = acquireQuery();
+        if (!filter || !context)
             return point;
 
         const auto &transform = getOwner()->getTransform()->getWorldMatrix();
@@ -758,7 +1401,7 @@ namespace ige::scene
         if (!nearestRef)
             nearestRef = &pointRef;
 
-        m_navMeshQuery->findNearestPoly(localPoint.P(), extents.P(), filter, nearestRef, nearestPoint.P());
+        context->query->findNearestPoly(localPoint.P(), extents.P(), filter, nearestRef, nearestPoint.P());
         return *nearestRef ? transform * nearestPoint : point;
     }
 
@@ -778,7 +1421,9 @@ namespace ige::scene
     {
         dest.clear();
 
-        if (!filter || !initializeQuery())
+        std::shared_lock<std::shared_mutex> lock(m_navMeshMutex);
+        auto context = acquireQuery();
+        if (!filter || !context)
             return;
 
         // Navigation data is in local space. Transform path points from world to local
@@ -790,71 +1435,225 @@ namespace ige::scene
 
         dtPolyRef startRef;
         dtPolyRef endRef;
-        m_navMeshQuery->findNearestPoly(localStart.P(), extents.P(), filter, &startRef, nullptr);
-        m_navMeshQuery->findNearestPoly(localEnd.P(), extents.P(), filter, &endRef, nullptr);
+        context->query->findNearestPoly(localStart.P(), extents.P(), filter, &startRef, nullptr);
+        context->query->findNearestPoly(localEnd.P(), extents.P(), filter, &endRef, nullptr);
 
         if (!startRef || !endRef)
             return;
 
         int numPolys = 0;
-        int numPathPoints = 0;
 
-        m_navMeshQuery->findPath(startRef, endRef, localStart.P(), localEnd.P(), filter, m_pathData->polys, &numPolys, MAX_POLYS);
+        context->query->findPath(startRef, endRef, localStart.P(), localEnd.P(), filter, context->pathData->polys, &numPolys, MAX_POLYS);
         if (!numPolys)
             return;
 
+        buildPathPoints(*context, dest, localStart, localEnd, endRef, numPolys);
+    }
+
+    //! Convert the polygon corridor in the context scratch buffer to world space path points
+    void NavMesh::buildPathPoints(NavQueryContext &context, std::vector<NavPathPoint> &dest, const Vec3 &localStart, const Vec3 &localEnd, dtPolyRef endRef, int numPolys)
+    {
+        dest.clear();
+        if (numPolys <= 0)
+            return;
+
+        auto query = context.query;
+        auto pathData = context.pathData.get();
+
+        const auto &transform = getOwner()->getTransform()->getWorldMatrix();
+        int numPathPoints = 0;
         auto actualLocalEnd = localEnd;
 
         // If full path was not found, clamp end point to the end polygon
-        if (m_pathData->polys[numPolys - 1] != endRef)
-            m_navMeshQuery->closestPointOnPoly(m_pathData->polys[numPolys - 1], localEnd.P(), actualLocalEnd.P(), nullptr);
+        if (pathData->polys[numPolys - 1] != endRef)
+            query->closestPointOnPoly(pathData->polys[numPolys - 1], localEnd.P(), actualLocalEnd.P(), nullptr);
 
-        m_navMeshQuery->findStraightPath(localStart.P(), actualLocalEnd.P(), m_pathData->polys, numPolys,
-                                         m_pathData->pathPoints[0].P(), m_pathData->pathFlags, m_pathData->pathPolys, &numPathPoints, MAX_POLYS);
+        query->findStraightPath(localStart.P(), actualLocalEnd.P(), pathData->polys, numPolys,
+                                         pathData->pathPoints[0].P(), pathData->pathFlags, pathData->pathPolys, &numPathPoints, MAX_POLYS);
 
         // Transform path result back to world space
         for (int i = 0; i < numPathPoints; ++i)
         {
             NavPathPoint pt;
-            pt.position = transform *m_pathData->pathPoints[i];
-            pt.flag = (NavPathPoint::Flag)m_pathData->pathFlags[i];
-            uint32_t nearestNavAreaID = 0; // 0 is the default nav area ID
+            pt.position = transform *pathData->pathPoints[i];
+            pt.flag = (NavPathPoint::Flag)pathData->pathFlags[i];
+
+            // NavAreas are baked into polygon areas, the end point has no polygon of its own
+            const auto polyRef = pathData->pathPolys[i] ? pathData->pathPolys[i] : pathData->polys[numPolys - 1];
+            const auto area = getPolyArea(polyRef);
+            pt.areaID = area == RC_WALKABLE_AREA ? 0 : area; // 0 is the default nav area ID
+            dest.push_back(pt);
+        }
+    }
 
-            // Walk through all NavAreas and find nearest
-            float nearestDistance = std::numeric_limits<float>::max();
-            for (auto area: m_areas)
+    //! Queue a time-sliced path query
+    uint32_t NavMesh::requestPath(const Vec3 &start, const Vec3 &end, const Vec3 &extents, const dtQueryFilter *filter, int priority)
+    {
+        if (!m_navMesh)
+            return 0;
+
+        auto ticket = m_nextPathTicket++;
+        if (m_nextPathTicket == 0)
+            m_nextPathTicket = 1;
+
+        auto &request = m_pathRequests[ticket];
+        request.start = start;
+        request.end = end;
+        request.extents = extents;
+        if (filter)
+            request.filter = *filter;
+        request.priority = priority;
+        m_pathQueue.insert({-priority, ticket});
+        return ticket;
+    }
+
+    //! Cancel a queued or running path request
+    bool NavMesh::cancelPath(uint32_t ticket)
+    {
+        auto itr = m_pathRequests.find(ticket);
+        if (itr == m_pathRequests.end())
+            return false;
+
+        m_pathQueue.erase({-itr->second.priority, ticket});
+        if (m_currentPath == ticket)
+            m_currentPath = 0;
+        m_pathRequests.erase(itr);
+        return true;
+    }
+
+    //! Return status of the path request
+    NavMesh::EPathStatus NavMesh::getPathStatus(uint32_t ticket) const
+    {
+        auto itr = m_pathRequests.find(ticket);
+        return itr != m_pathRequests.end() ? itr->second.status : EPathStatus::INVALID;
+    }
+
+    //! Take the result of a finished path request
+    bool NavMesh::getPathResult(uint32_t ticket, std::vector<NavPathPoint> &dest)
+    {
+        dest.clear();
+        auto itr = m_pathRequests.find(ticket);
+        if (itr == m_pathRequests.end() || itr->second.status == EPathStatus::PENDING)
+            return false;
+
+        dest = std::move(itr->second.points);
+        m_pathRequests.erase(itr);
+        return true;
+    }
+
+    //! Take the result of a finished path request
+    bool NavMesh::getPathResult(uint32_t ticket, std::vector<Vec3> &dest)
+    {
+        std::vector<NavPathPoint> navPathPoints;
+        auto ret = getPathResult(ticket, navPathPoints);
+
+        dest.clear();
+        for (size_t i = 0; i < navPathPoints.size(); ++i)
+            dest.push_back(navPathPoints[i].position);
+        return ret;
+    }
+
+    //! Run queued path requests within the iteration budget
+    void NavMesh::updatePathRequests()
+    {
+        // Release results nobody collected
+        for (auto itr = m_pathRequests.begin(); itr != m_pathRequests.end();)
+        {
+            if (itr->second.status != EPathStatus::PENDING && ++itr->second.age > PATH_RESULT_MAX_AGE)
+                itr = m_pathRequests.erase(itr);
+            else
+                ++itr;
+        }
+
+        if ((m_currentPath == 0 && m_pathQueue.empty()) || !m_navMesh)
+            return;
+
+        // Navigation mesh replaced: init the query on the new one
+        if (m_slicedQueryMesh != m_navMesh)
+        {
+            if (!m_slicedQuery)
+                m_slicedQuery = dtAllocNavMeshQuery();
+            if (!m_slicedQuery || dtStatusFailed(m_slicedQuery->init(m_navMesh, MAX_POLYS)))
+                return;
+            m_slicedQueryMesh = m_navMesh;
+        }
+
+        // Mesh or tiles changed since the running search started: its polygons may be gone, start it again
+        if (m_currentPath != 0 && m_slicedQueryVersion != m_navMeshVersion)
+        {
+            m_pathQueue.insert({-m_pathRequests[m_currentPath].priority, m_currentPath});
+            m_currentPath = 0;
+        }
+
+        std::shared_lock<std::shared_mutex> lock(m_navMeshMutex);
+        auto context = acquireQuery();
+        if (!context)
+            return;
+
+        auto inverse = getOwner()->getTransform()->getWorldMatrix().Inverse();
+        auto budget = m_pathIterationBudget;
+        while (budget > 0)
+        {
+            // Start the next request
+            if (m_currentPath == 0)
             {
-                if (area && area->isEnabled())
+                if (m_pathQueue.empty())
+                    break;
+
+                auto ticket = m_pathQueue.begin()->second;
+                m_pathQueue.erase(m_pathQueue.begin());
+                auto &request = m_pathRequests[ticket];
+                request.localStart = inverse * request.start;
+                request.localEnd = inverse * request.end;
+
+                dtPolyRef startRef = 0;
+                request.endRef = 0;
+                m_slicedQuery->findNearestPoly(request.localStart.P(), request.extents.P(), &request.filter, &startRef, nullptr);
+                m_slicedQuery->findNearestPoly(request.localEnd.P(), request.extents.P(), &request.filter, &request.endRef, nullptr);
+                --budget;
+
+                if (!startRef || !request.endRef ||
+                    dtStatusFailed(m_slicedQuery->initSlicedFindPath(startRef, request.endRef, request.localStart.P(), request.localEnd.P(), &request.filter)))
                 {
-                    auto aabb = area->getWorldBoundingBox();
-                    if (aabb.isPointInside(pt.position))
-                    {
-                        auto areaWorldCenter = area->getOwner()->getTransform()->getPosition();
-                        float distance = Vec3::LengthSqr(areaWorldCenter - pt.position);
-                        if (distance < nearestDistance)
-                        {
-                            nearestDistance = distance;
-                            nearestNavAreaID = area->getAreaId();
-                        }
-                    }
+                    request.status = EPathStatus::FAILED;
+                    continue;
                 }
+                m_currentPath = ticket;
+                m_slicedQueryVersion = m_navMeshVersion;
             }
-            pt.areaID = (uint8_t)nearestNavAreaID;
-            dest.push_back(pt);
+
+            int numIterations = 0;
+            auto status = m_slicedQuery->updateSlicedFindPath(budget, &numIterations);
+            budget -= std::max(numIterations, 1);
+            if (dtStatusInProgress(status))
+                continue;
+
+            // Search finished, requests are node based so the reference stays valid
+            auto &request = m_pathRequests[m_currentPath];
+            m_currentPath = 0;
+
+            int numPolys = 0;
+            if (dtStatusSucceed(status))
+                m_slicedQuery->finalizeSlicedFindPath(context->pathData->polys, &numPolys, MAX_POLYS);
+
+            buildPathPoints(*context, request.points, request.localStart, request.localEnd, request.endRef, numPolys);
+            request.status = request.points.empty() ? EPathStatus::FAILED : EPathStatus::COMPLETED;
         }
     }
 
     //! Return a random point on the navigation mesh.
     Vec3 NavMesh::getRandomPoint(const dtQueryFilter *filter, dtPolyRef *randomRef)
     {
-        if (!filter || !initializeQuery())
+        std::shared_lock<std::shared_mutex> lock(m_navMeshMutex);
+        auto context = acquireQuery();
+        if (!filter || !context)
             return {0.f, 0.f, 0.f};
 
         dtPolyRef polyRef;
         Vec3 point = {0.f, 0.f, 0.f};
 
-        auto random = []() { return std::rand() / float(RAND_MAX); };
-        m_navMeshQuery->findRandomPoint(filter, random, randomRef ? randomRef : &polyRef, point.P());
+        auto random = []() { return getRandomFloat(); };
+        context->query->findRandomPoint(filter, random, randomRef ? randomRef : &polyRef, point.P());
 
         const auto &transform = getOwner()->getTransform()->getWorldMatrix();
         return transform * point;
@@ -866,7 +1665,9 @@ namespace ige::scene
         if (randomRef)
             *randomRef = 0;
 
-        if (!filter || !initializeQuery())
+        std::shared_lock<std::shared_mutex> lock(m_navMeshMutex);
+        auto context = acquireQuery();
+        if (!filter || !context)
             return center;
 
         const auto &transform = getOwner()->getTransform()->getWorldMatrix();
@@ -874,7 +1675,7 @@ namespace ige::scene
         auto localCenter = inverse * center;
 
         dtPolyRef startRef;
-        m_navMeshQuery->findNearestPoly(localCenter.P(), extents.P(), filter, &startRef, nullptr);
+        context->query->findNearestPoly(localCenter.P(), extents.P(), filter, &startRef, nullptr);
         if (!startRef)
             return center;
 
@@ -883,8 +1684,8 @@ namespace ige::scene
             randomRef = &polyRef;
 
         auto point = localCenter;
-        auto random = []() { return std::rand() / float(RAND_MAX); };
-        m_navMeshQuery->findRandomPointAroundCircle(startRef, localCenter.P(), radius, filter, random, randomRef, point.P());
+        auto random = []() { return getRandomFloat(); };
+        context->query->findRandomPointAroundCircle(startRef, localCenter.P(), radius, filter, random, randomRef, point.P());
         return transform * point;
     }
 
@@ -897,7 +1698,9 @@ namespace ige::scene
         if (hitNormal)
             *hitNormal = {0.f, -1.f, 0.f};
 
-        if (!filter || !initializeQuery())
+        std::shared_lock<std::shared_mutex> lock(m_navMeshMutex);
+        auto context = acquireQuery();
+        if (!filter || !context)
             return radius;
 
         const auto &transform = getOwner()->getTransform()->getWorldMatrix();
@@ -905,7 +1708,7 @@ namespace ige::scene
         auto localPoint = inverse * point;
 
         dtPolyRef startRef;
-        m_navMeshQuery->findNearestPoly(localPoint.P(), extents.P(), filter, &startRef, nullptr);
+        context->query->findNearestPoly(localPoint.P(), extents.P(), filter, &startRef, nullptr);
         if (!startRef)
             return radius;
         float hitDist = radius;
@@ -915,7 +1718,7 @@ namespace ige::scene
         Vec3 normal;
         if (!hitNormal)
             hitNormal = &normal;
-        m_navMeshQuery->findDistanceToWall(startRef, localPoint.P(), radius, filter, &hitDist, hitPos->P(), hitNormal->P());
+        context->query->findDistanceToWall(startRef, localPoint.P(), radius, filter, &hitDist, hitPos->P(), hitNormal->P());
         return hitDist;
     }
 
@@ -925,7 +1728,9 @@ namespace ige::scene
         if (hitNormal)
             *hitNormal = {0.f, -1.f, 0.f};
 
-        if (!filter || !initializeQuery())
+        std::shared_lock<std::shared_mutex> lock(m_navMeshMutex);
+        auto context = acquireQuery();
+        if (!filter || !context)
             return end;
 
         const auto &transform = getOwner()->getTransform()->getWorldMatrix();
@@ -934,7 +1739,7 @@ namespace ige::scene
         auto localEnd = inverse * end;
 
         dtPolyRef startRef;
-        m_navMeshQuery->findNearestPoly(localStart.P(), extents.P(), filter, &startRef, nullptr);
+        context->query->findNearestPoly(localStart.P(), extents.P(), filter, &startRef, nullptr);
         if (!startRef)
             return end;
 
@@ -944,7 +1749,7 @@ namespace ige::scene
         float t;
         int numPolys;
 
-        m_navMeshQuery->raycast(startRef, localStart.P(), localEnd.P(), filter, &t, hitNormal->P(), m_pathData->polys, &numPolys, MAX_POLYS);
+        context->query->raycast(startRef, localStart.P(), localEnd.P(), filter, &t, hitNormal->P(), context->pathData->polys, &numPolys, MAX_POLYS);
         if (t == FLT_MAX)
             t = 1.0f;
 
@@ -970,11 +1775,7 @@ namespace ige::scene
         buffer.read<int>(params.maxTiles);
         buffer.read<int>(params.maxPolys);
 
-        m_navMesh = dtAllocNavMesh();
-        if (!m_navMesh)
-            return;
-
-        if (dtStatusFailed(m_navMesh->init(&params)))
+        if (!createNavMesh(params))
         {
             releaseNavMesh();
             return;
@@ -983,11 +1784,14 @@ namespace ige::scene
         unsigned numTiles = 0;
         while (!buffer.isEof())
         {
-            if (addTile(buffer))
+            if (readTile(buffer))
                 ++numTiles;
             else
-                return;
+                break;
         }
+
+        std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+        updatePolyTable();
     }
 
     //! Return navigation data attribute.
@@ -1014,6 +1818,65 @@ namespace ige::scene
         return ret;
     }
 
+    //! Allocate and initialize the navigation mesh, published under the write lock
+    bool NavMesh::createNavMesh(const dtNavMeshParams &params)
+    {
+        auto navMesh = dtAllocNavMesh();
+        if (!navMesh)
+            return false;
+
+        if (dtStatusFailed(navMesh->init(&params)))
+        {
+            dtFreeNavMesh(navMesh);
+            return false;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+        ++m_navMeshVersion;
+        m_polyTable.clear();
+        m_navMesh = navMesh;
+        return true;
+    }
+
+    //! Take a query context from the pool, the caller holds the read lock
+    std::shared_ptr<NavQueryContext> NavMesh::acquireQuery()
+    {
+        if (!m_navMesh)
+            return nullptr;
+
+        std::unique_ptr<NavQueryContext> context;
+        {
+            std::lock_guard<std::mutex> lock(m_queryPoolMutex);
+            if (!m_queryPool.empty())
+            {
+                context = std::move(m_queryPool.back());
+                m_queryPool.pop_back();
+            }
+        }
+
+        if (!context)
+        {
+            context = std::make_unique<NavQueryContext>();
+            context->query = dtAllocNavMeshQuery();
+            context->pathData = std::make_unique<FindPathData>();
+            if (!context->query)
+                return nullptr;
+        }
+
+        // Navigation mesh replaced since the last use
+        if (context->navMesh != m_navMesh)
+        {
+            if (dtStatusFailed(context->query->init(m_navMesh, MAX_POLYS)))
+                return nullptr;
+            context->navMesh = m_navMesh;
+        }
+
+        return std::shared_ptr<NavQueryContext>(context.release(), [this](NavQueryContext *ctx) {
+            std::lock_guard<std::mutex> lock(m_queryPoolMutex);
+            m_queryPool.emplace_back(ctx);
+        });
+    }
+
     bool NavMesh::initializeQuery()
     {
         if (!m_navMesh)
@@ -1043,10 +1906,290 @@ namespace ige::scene
         return worldAabb;
     }
 
+    //! Return the flow field toward the goal
+    std::shared_ptr<NavFlowField> NavMesh::getFlowField(const Vec3 &goal, const Vec3 &extents, const dtQueryFilter *filter)
+    {
+        if (!filter)
+            return nullptr;
+
+        for (auto &weakField : m_flowFields)
+        {
+            auto field = weakField.lock();
+            if (field && field->filterKey == filter && field->goal == goal && field->extents == extents)
+            {
+                if (field->version != m_navMeshVersion)
+                    buildFlowField(*field);
+                return field;
+            }
+        }
+
+        auto field = std::make_shared<NavFlowField>();
+        field->goal = goal;
+        field->extents = extents;
+        field->filter = *filter;
+        field->filterKey = filter;
+        buildFlowField(*field);
+
+        auto found = std::find_if(m_flowFields.begin(), m_flowFields.end(), [](const auto &weakField) { return weakField.expired(); });
+        if (found != m_flowFields.end())
+            *found = field;
+        else
+            m_flowFields.push_back(field);
+        return field;
+    }
+
+    //! Run Dijkstra from the goal polygon over the whole polygon graph
+    bool NavMesh::buildFlowField(NavFlowField &field)
+    {
+        std::shared_lock<std::shared_mutex> lock(m_navMeshMutex);
+        field.version = m_navMeshVersion;
+        field.goalRef = 0;
+        field.tileStarts.clear();
+        field.tileSalts.clear();
+        field.nodes.clear();
+
+        auto context = acquireQuery();
+        if (!context)
+            return false;
+
+        // One node per polygon, laid out by tile index
+        const dtNavMesh *navMesh = m_navMesh;
+        const auto maxTiles = navMesh->getMaxTiles();
+        field.tileStarts.resize(maxTiles + 1);
+        field.tileSalts.resize(maxTiles);
+        uint32_t numNodes = 0;
+        for (int i = 0; i < maxTiles; ++i)
+        {
+            const auto tile = navMesh->getTile(i);
+            field.tileStarts[i] = numNodes;
+            field.tileSalts[i] = tile->salt;
+            if (tile->header)
+                numNodes += tile->header->polyCount;
+        }
+        field.tileStarts[maxTiles] = numNodes;
+        field.nodes.resize(numNodes);
+
+        auto localGoal = getOwner()->getTransform()->getWorldMatrix().Inverse() * field.goal;
+        context->query->findNearestPoly(localGoal.P(), field.extents.P(), &field.filter, &field.goalRef, field.localGoal.P());
+        if (!field.goalRef)
+            return false;
+
+        auto getNodeIndex = [&](dtPolyRef ref) {
+            unsigned int salt, it, ip;
+            navMesh->decodePolyId(ref, salt, it, ip);
+            return field.tileStarts[it] + ip;
+        };
+
+        // Search backward from the goal, each polygon learns the cheapest next polygon toward it
+        using OpenNode = std::pair<float, dtPolyRef>;
+        std::priority_queue<OpenNode, std::vector<OpenNode>, std::greater<OpenNode>> open;
+        auto &goalNode = field.nodes[getNodeIndex(field.goalRef)];
+        goalNode.cost = 0.f;
+        goalNode.target = field.localGoal;
+        open.push({0.f, field.goalRef});
+
+        while (!open.empty())
+        {
+            const auto cost = open.top().first;
+            const auto ref = open.top().second;
+            open.pop();
+
+            const auto &node = field.nodes[getNodeIndex(ref)];
+            if (cost > node.cost)
+                continue;
+
+            const dtMeshTile *tile = nullptr;
+            const dtPoly *poly = nullptr;
+            navMesh->getTileAndPolyByRefUnsafe(ref, &tile, &poly);
+
+            for (auto i = poly->firstLink; i != DT_NULL_LINK; i = tile->links[i].next)
+            {
+                const auto neighbourRef = tile->links[i].ref;
+                if (!neighbourRef)
+                    continue;
+
+                const dtMeshTile *neighbourTile = nullptr;
+                const dtPoly *neighbourPoly = nullptr;
+                navMesh->getTileAndPolyByRefUnsafe(neighbourRef, &neighbourTile, &neighbourPoly);
+                if (!field.filter.passFilter(neighbourRef, neighbourTile, neighbourPoly))
+                    continue;
+
+                // The neighbour must link back, one-way off-mesh connections are not walked backward
+                const dtLink *backLink = nullptr;
+                for (auto j = neighbourPoly->firstLink; j != DT_NULL_LINK; j = neighbourTile->links[j].next)
+                {
+                    if (neighbourTile->links[j].ref == ref)
+                    {
+                        backLink = &neighbourTile->links[j];
+                        break;
+                    }
+                }
+                if (!backLink)
+                    continue;
+
+                const auto portal = getPortalPoint(neighbourRef, neighbourTile, neighbourPoly, *backLink, tile, poly);
+                const auto newCost = node.cost + field.filter.getCost(portal.P(), node.target.P(), neighbourRef, neighbourTile, neighbourPoly,
+                                                                      ref, tile, poly, 0, nullptr, nullptr);
+
+                auto &neighbourNode = field.nodes[getNodeIndex(neighbourRef)];
+                if (newCost < neighbourNode.cost)
+                {
+                    neighbourNode.cost = newCost;
+                    neighbourNode.next = ref;
+                    neighbourNode.target = portal;
+                    open.push({newCost, neighbourRef});
+                }
+            }
+        }
+        return true;
+    }
+
+    //! Area ID of the polygon
+    uint8_t NavMesh::getPolyArea(dtPolyRef ref) const
+    {
+        if (!m_navMesh || !ref)
+            return RC_NULL_AREA;
+
+        unsigned int salt, it, ip;
+        m_navMesh->decodePolyId(ref, salt, it, ip);
+        if (it < m_polyTable.size() && m_polyTable[it].salt == salt && ip < m_polyTable[it].areas.size())
+            return m_polyTable[it].areas[ip];
+
+        // Tile replaced since the last refresh
+        uint8_t area = RC_NULL_AREA;
+        m_navMesh->getPolyArea(ref, &area);
+        return area;
+    }
+
+    //! Flags of the polygon
+    uint16_t NavMesh::getPolyFlags(dtPolyRef ref) const
+    {
+        if (!m_navMesh || !ref)
+            return 0;
+
+        unsigned int salt, it, ip;
+        m_navMesh->decodePolyId(ref, salt, it, ip);
+        if (it < m_polyTable.size() && m_polyTable[it].salt == salt && ip < m_polyTable[it].flags.size())
+        {
+            auto found = m_areaFlags.find(m_polyTable[it].areas[ip]);
+            return found != m_areaFlags.end() ? found->second : m_polyTable[it].flags[ip];
+        }
+
+        uint16_t flags = 0;
+        m_navMesh->getPolyFlags(ref, &flags);
+        return flags;
+    }
+
+    //! Override flags of every polygon with the area ID
+    void NavMesh::setAreaFlags(uint8_t areaID, uint16_t flags)
+    {
+        std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+        m_areaFlags[areaID] = flags;
+        if (!m_navMesh)
+            return;
+
+        updatePolyTable();
+        for (size_t it = 0; it < m_polyTable.size(); ++it)
+        {
+            const auto &tile = m_polyTable[it];
+            const auto base = m_navMesh->getPolyRefBase(m_navMesh->getTile((int)it));
+            for (size_t ip = 0; ip < tile.areas.size(); ++ip)
+            {
+                if (tile.areas[ip] == areaID)
+                    m_navMesh->setPolyFlags(base | (dtPolyRef)ip, flags);
+            }
+        }
+    }
+
+    //! Restore built flags of polygons with the area ID
+    void NavMesh::resetAreaFlags(uint8_t areaID)
+    {
+        std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+        if (m_areaFlags.erase(areaID) == 0 || !m_navMesh)
+            return;
+
+        updatePolyTable();
+        for (size_t it = 0; it < m_polyTable.size(); ++it)
+        {
+            const auto &tile = m_polyTable[it];
+            const auto base = m_navMesh->getPolyRefBase(m_navMesh->getTile((int)it));
+            for (size_t ip = 0; ip < tile.areas.size(); ++ip)
+            {
+                if (tile.areas[ip] == areaID)
+                    m_navMesh->setPolyFlags(base | (dtPolyRef)ip, tile.flags[ip]);
+            }
+        }
+    }
+
+    //! Refresh the polygon table for replaced tiles
+    void NavMesh::updatePolyTable()
+    {
+        m_polyTableVersion = m_navMeshVersion;
+        if (!m_navMesh)
+        {
+            m_polyTable.clear();
+            return;
+        }
+
+        const dtNavMesh *navMesh = m_navMesh;
+        m_polyTable.resize(navMesh->getMaxTiles());
+        for (size_t it = 0; it < m_polyTable.size(); ++it)
+        {
+            const auto tile = navMesh->getTile((int)it);
+            auto &tableTile = m_polyTable[it];
+            if (tableTile.salt == tile->salt && tableTile.header == tile->header)
+                continue;
+
+            tableTile.salt = tile->salt;
+            tableTile.header = tile->header;
+            tableTile.areas.clear();
+            tableTile.flags.clear();
+            if (!tile->header)
+                continue;
+
+            const auto base = navMesh->getPolyRefBase(tile);
+            tableTile.areas.resize(tile->header->polyCount);
+            tableTile.flags.resize(tile->header->polyCount);
+            for (int ip = 0; ip < tile->header->polyCount; ++ip)
+            {
+                const auto &poly = tile->polys[ip];
+                tableTile.areas[ip] = poly.getArea();
+                tableTile.flags[ip] = poly.flags;
+
+                // New tiles are built with their original flags
+                auto found = m_areaFlags.find(tableTile.areas[ip]);
+                if (found != m_areaFlags.end())
+                    m_navMesh->setPolyFlags(base | (dtPolyRef)ip, found->second);
+            }
+        }
+    }
+
+    //! Rebuild referenced flow fields after tile changes, drop released ones
+    void NavMesh::updateFlowFields()
+    {
+        m_flowFields.erase(std::remove_if(m_flowFields.begin(), m_flowFields.end(), [](const auto &weakField) { return weakField.expired(); }), m_flowFields.end());
+        for (auto &weakField : m_flowFields)
+        {
+            auto field = weakField.lock();
+            if (field && field->version != m_navMeshVersion)
+                buildFlowField(*field);
+        }
+    }
+
     //! Update
     void NavMesh::onUpdate(float dt)
     {
-
+        if (isEnabled())
+        {
+            updateAsyncBuild();
+            if (m_polyTableVersion != m_navMeshVersion)
+            {
+                std::unique_lock<std::shared_mutex> lock(m_navMeshMutex);
+                updatePolyTable();
+            }
+            updatePathRequests();
+            updateFlowFields();
+        }
     }
 
     //! Render
@@ -1117,6 +2260,7 @@ namespace ige::scene
         j["padding"] = getPadding();
         j["partType"] = (int)getPartitionType();
         j["debug"] = isShowDebug();
+        j["bake"] = isBakeEnabled();
     }
 
     //! Deserialize
@@ -1138,6 +2282,7 @@ namespace ige::scene
         setPadding(j.value("padding", Vec3(0.f, 0.f, 0.f)));
         setPartitionType((EPartitionType)j.value("partType", (int)EPartitionType::WATERSHED));
         setShowDebug(j.value("debug", false));
+        setBakeEnabled(j.value("bake", true));
         Component::from_json(j);
     }
 
@@ -1148,8 +2293,9 @@ namespace ige::scene
         // Ensure transform updated
         getOwner()->getTransform()->onUpdate(0.f);
 
-        // Build after load finish
-        build();
+        // Load baked tiles, or build after load finish
+        if (!loadBakedData())
+            build();
     }
 
     //! Update property by key value
@@ -1219,6 +2365,10 @@ namespace ige::scene
         {
             setShowDebug(val);
         }
+        else if (key.compare("bake") == 0)
+        {
+            setBakeEnabled(val);
+        }
         else
         {
             Component::setProperty(key, val);
@@ -7,6 +7,14 @@
 #include <DetourNavMeshQuery.h>
 #include <Recast.h>
 
+#include <algorithm>
+#include <cfloat>
+#include <future>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <unordered_map>
+
 #include "utils/PyxieHeaders.h"
 using namespace pyxie;
 
@@ -20,6 +28,7 @@ class dtQueryFilter;
 namespace ige::scene
 {
     class NavArea;
+    class HeightfieldCollider;
     class NavAgentManager;
 
     //! Path finding data
@@ -149,6 +158,98 @@ namespace ige::scene
         rcPolyMeshDetail *polyMeshDetail;
     };
 
+    //! NavQueryContext: Detour query with its own scratch buffers, one per concurrent caller
+    struct NavQueryContext
+    {
+        //! Destructor
+        ~NavQueryContext();
+
+        //! Detour query
+        dtNavMeshQuery *query = nullptr;
+
+        //! Navigation mesh the query was initialized with
+        dtNavMesh *navMesh = nullptr;
+
+        //! Scratch buffers
+        std::unique_ptr<FindPathData> pathData;
+    };
+
+    //! NavTriMesh: figure triangles collected once per build, indexed by a 2D grid on XZ so each tile only reads the triangles it overlaps
+    struct NavTriMesh
+    {
+        //! Build the grid index over the collected triangles
+        void buildIndex(float cellSize);
+
+        //! Append triangles overlapping the box on XZ to the tile geometry
+        void query(const AABBox &box, std::vector<std::array<float, 3>> &outVertices, std::vector<int> &outIndices) const;
+
+        //! Vertices
+        std::vector<std::array<float, 3>> vertices;
+
+        //! Triangle indices
+        std::vector<int> indices;
+
+        //! Grid origin on XZ, cell size and dimensions
+        float originX = 0.f;
+        float originZ = 0.f;
+        float cellSize = 1.f;
+        int width = 0;
+        int height = 0;
+
+        //! Triangles of each cell, cell i owns cellTriangles[cellStarts[i], cellStarts[i + 1])
+        std::vector<int> cellStarts;
+        std::vector<int> cellTriangles;
+    };
+
+    //! NavTileJob: one tile build, geometry gathered on the calling thread and built on a worker
+    struct NavTileJob
+    {
+        //! Destructor
+        virtual ~NavTileJob() = default;
+
+        //! Tile index
+        int x = 0;
+        int z = 0;
+
+        //! Recast config
+        rcConfig cfg;
+    };
+
+    //! NavFlowField: Dijkstra map over the polygon graph toward one goal, shared by all agents heading there
+    struct NavFlowField
+    {
+        //! Polygon node: cost to the goal, next polygon and the point to steer to, in navigation mesh space
+        struct Node
+        {
+            float cost = FLT_MAX;
+            dtPolyRef next = 0;
+            Vec3 target;
+        };
+
+        //! Return the node of the polygon, null if unreachable or not part of the field
+        const Node *getNode(const dtNavMesh *navMesh, dtPolyRef ref) const;
+
+        //! Goal in world space, goal polygon and goal in navigation mesh space
+        Vec3 goal;
+        dtPolyRef goalRef = 0;
+        Vec3 localGoal;
+
+        //! Extents used to find the goal polygon
+        Vec3 extents;
+
+        //! Copy of the filter taken on creation, and the filter used to look the field up
+        dtQueryFilter filter;
+        const dtQueryFilter *filterKey = nullptr;
+
+        //! Navigation mesh version the field was built on
+        uint32_t version = 0;
+
+        //! Nodes of tile i start at tileStarts[i], tile salts guard against replaced tiles
+        std::vector<uint32_t> tileStarts;
+        std::vector<uint32_t> tileSalts;
+        std::vector<Node> nodes;
+    };
+
 
     //! MeshCollider
     class NavMesh : public Component
@@ -160,6 +261,15 @@ namespace ige::scene
             MONOTONE
         };
 
+        //! Status of a time-sliced path request
+        enum class EPathStatus
+        {
+            INVALID = 0,
+            PENDING,
+            COMPLETED,
+            FAILED
+        };
+
     public:
         //! Constructor
         NavMesh(SceneObject& owner);
@@ -182,6 +292,16 @@ namespace ige::scene
         //! Rebuild part of the navigation mesh in the rectangular area
         virtual bool build(const Vec2& from, const Vec2& to);
 
+        //! Queue a rebuild of tiles touched by the world-space bounding box.
+        //! Tiles are built off-thread and swapped in on update, agents keep using the old tiles until then.
+        void buildAsync(const AABBox& boundingBox);
+
+        //! Queue a rebuild of tiles in the rectangular area
+        void buildAsync(const Vec2& from, const Vec2& to);
+
+        //! Return whether an async rebuild is queued or running
+        bool isBuildingAsync() const { return !m_dirtyTiles.empty() || m_asyncBuild.valid(); }
+
         //! Return tile data.
         virtual MemBuffer getTileData(const Vec2& tile) const;
 
@@ -218,6 +338,43 @@ namespace ige::scene
         //! Find a path between world space points. Return non-empty list of navigation path points if successful. Extents specifies how far off the navigation mesh the points can be.
         void findPath(std::vector<NavPathPoint> &dest, const Vec3 &start, const Vec3 &end, const Vec3 &extents = {1.f, 1.f, 1.f}, const dtQueryFilter *filter = nullptr);
 
+        //! Queue a time-sliced path query between world space points, searched on update within the iteration budget.
+        //! Higher priority requests run first. Return the ticket, 0 if the request was rejected.
+        uint32_t requestPath(const Vec3 &start, const Vec3 &end, const Vec3 &extents = {1.f, 1.f, 1.f}, const dtQueryFilter *filter = nullptr, int priority = 0);
+
+        //! Cancel a queued or running path request
+        bool cancelPath(uint32_t ticket);
+
+        //! Return status of the path request
+        EPathStatus getPathStatus(uint32_t ticket) const;
+
+        //! Take the result of a finished path request, the ticket is released. Return false while pending or if unknown.
+        //! Results not taken within 300 updates are released.
+        bool getPathResult(uint32_t ticket, std::vector<NavPathPoint> &dest);
+        bool getPathResult(uint32_t ticket, std::vector<Vec3> &dest);
+
+        //! Max sliced path search iterations per update, shared by all requests
+        int getPathIterationBudget() const { return m_pathIterationBudget; }
+        void setPathIterationBudget(int budget) { m_pathIterationBudget = std::max(budget, 1); }
+
+        //! Return the flow field toward the goal, shared while referenced. Built on first use and rebuilt on update after tile changes.
+        std::shared_ptr<NavFlowField> getFlowField(const Vec3 &goal, const Vec3 &extents = {1.f, 1.f, 1.f}, const dtQueryFilter *filter = nullptr);
+
+        //! Counter increased on every tile change
+        uint32_t getNavMeshVersion() const { return m_navMeshVersion; }
+
+        //! Area ID of the polygon, from the polygon table
+        uint8_t getPolyArea(dtPolyRef ref) const;
+
+        //! Flags of the polygon, from the polygon table
+        uint16_t getPolyFlags(dtPolyRef ref) const;
+
+        //! Override flags of every polygon with the area ID, kept across tile rebuilds
+        void setAreaFlags(uint8_t areaID, uint16_t flags);
+
+        //! Restore built flags of polygons with the area ID
+        void resetAreaFlags(uint8_t areaID);
+
         //! Return a random point on the navigation mesh.
         Vec3 getRandomPoint(const dtQueryFilter *filter = nullptr, dtPolyRef *randomRef = nullptr);
 
@@ -300,6 +457,16 @@ namespace ige::scene
         bool isShowDebug() const { return m_bShowDebug; }
         void setShowDebug(bool show = true) { m_bShowDebug = show; }
 
+        //! Persist baked tiles next to the scene, loaded instead of rebuilding while the geometry hash matches
+        bool isBakeEnabled() const { return m_bBakeEnabled; }
+        void setBakeEnabled(bool enable = true) { m_bBakeEnabled = enable; }
+
+        //! Save baked tiles next to the scene, LZ4 compressed, with the geometry hash. Called when the scene is saved.
+        bool saveBakedData();
+
+        //! Hash of build settings and geometry of the last build
+        uint64_t getGeometryHash() const { return m_geometryHash; }
+
         //! Number of tiles in X direction
         int getNumTilesX() const { return m_numTilesX; }
 
@@ -335,17 +502,86 @@ namespace ige::scene
         void collectGeometries(std::vector<NavGeoInfo> &geometryList, SceneObject *node, std::unordered_set<SceneObject *> &processedNodes, bool recursive);
 
         //! Get geometry data within a bounding box
-        void getTileGeometry(NavBuildData *build, std::vector<NavGeoInfo> &geometryList, AABBox &box);
+        void getTileGeometry(NavBuildData *build, std::vector<NavGeoInfo> &geometryList, const NavTriMesh &triMesh, AABBox &box);
+
+        //! Collect figure triangles of the geometry overlapping the bounds and index them
+        void buildTriMesh(std::vector<NavGeoInfo> &geometryList, const AABBox &bounds, NavTriMesh &triMesh);
+
+        //! Hash build settings and collected geometry
+        virtual uint64_t computeGeometryHash(const std::vector<NavGeoInfo> &geometryList) const;
+
+        //! FNV-1a hash helper
+        static uint64_t hashBytes(uint64_t hash, const void *data, size_t size);
+
+        //! Path of the baked data file, empty if the scene is not saved yet
+        std::string getBakedDataPath() const;
+
+        //! Load baked tiles if the stored hash matches the current geometry
+        bool loadBakedData();
+
+        //! Navigation data loaded from baked data
+        virtual void onNavDataLoaded() {}
 
         //! Add a triangle mesh to the geometry data.
-        void addTriMeshGeometry(NavBuildData *build, Figure *figure, const Mat4 &transform);
+        void addTriMeshGeometry(NavTriMesh &triMesh, Figure *figure, const Mat4 &transform);
+
+        //! Add heightfield cells overlapping the bounding box to the geometry data.
+        void addHeightfieldGeometry(NavBuildData *build, HeightfieldCollider *heightfield, const AABBox &box);
+
+        //! Recast config of the tile, bounds include the border
+        rcConfig getTileConfig(int x, int z) const;
 
-        //! Build one tile of the navigation mesh
-        virtual bool buildTile(std::vector<NavGeoInfo> &geometryList, int x, int z);
+        //! Bounds of the tile range, including the tile border
+        AABBox getTileRangeBounds(const Vec2 &from, const Vec2 &to) const;
+
+        //! Get geometry data within the tile config bounds
+        void getTileGeometry(NavBuildData *build, std::vector<NavGeoInfo> &geometryList, const NavTriMesh &triMesh, const rcConfig &cfg);
+
+        //! Run the Recast pipeline on collected tile geometry, thread safe. Output is null for empty tiles.
+        bool buildTileData(SimpleNavBuildData &build, const rcConfig &cfg, int x, int z, uint8_t *&navData, int &navDataSize) const;
 
         //! Build tiles in the rectangular area. Return number of built tiles.
         virtual uint32_t buildTiles(std::vector<NavGeoInfo> &geometryList, const Vec2 &from, const Vec2 &to);
 
+        //! Gather geometry of the tile into a build job, on the calling thread
+        virtual std::unique_ptr<NavTileJob> createTileJob(std::vector<NavGeoInfo> &geometryList, const NavTriMesh &triMesh, int x, int z);
+
+        //! Build the job, thread safe
+        virtual void runTileJob(NavTileJob &job) const;
+
+        //! Replace the tile with the job result. Return number of added tiles.
+        virtual uint32_t commitTileJob(NavTileJob &job);
+
+        //! Tile range touched by the world-space bounding box
+        void getTileRange(const AABBox &boundingBox, Vec2 &from, Vec2 &to) const;
+
+        //! Swap in finished async tiles, then start the next queued rebuild
+        void updateAsyncBuild();
+
+        //! Run queued path requests within the iteration budget, drop expired results
+        void updatePathRequests();
+
+        //! Run Dijkstra from the goal polygon over the whole polygon graph
+        bool buildFlowField(NavFlowField &field);
+
+        //! Rebuild referenced flow fields after tile changes, drop released ones
+        void updateFlowFields();
+
+        //! Refresh the polygon table for tiles replaced since the last refresh and apply area flag overrides. The caller holds the write lock.
+        void updatePolyTable();
+
+        //! Convert the polygon corridor in the context scratch buffer to world space path points
+        void buildPathPoints(NavQueryContext &context, std::vector<NavPathPoint> &dest, const Vec3 &localStart, const Vec3 &localEnd, dtPolyRef endRef, int numPolys);
+
+        //! Allocate and initialize the navigation mesh, published under the write lock
+        bool createNavMesh(const dtNavMeshParams &params);
+
+        //! Take a query context from the pool, returned when released. The caller holds the read lock.
+        std::shared_ptr<NavQueryContext> acquireQuery();
+
+        //! Wait for the running async rebuild and drop its results
+        void cancelAsyncBuild();
+
         //! Write tile data.
         void writeTile(MemBuffer& dest, int x, int z) const;
 
@@ -371,8 +607,12 @@ namespace ige::scene
         //! Detour navigation mesh query
         dtNavMeshQuery *m_navMeshQuery = nullptr;
 
-        //! Temporary data for finding a path
-        std::unique_ptr<FindPathData> m_pathData = nullptr;
+        //! Pooled query contexts, so queries can run concurrently from worker threads
+        std::vector<std::unique_ptr<NavQueryContext>> m_queryPool;
+        std::mutex m_queryPoolMutex;
+
+        //! Queries hold the read lock, tile changes hold the write lock
+        mutable std::shared_mutex m_navMeshMutex;
 
         //! Cell size
         float m_cellSize;
@@ -434,6 +674,85 @@ namespace ige::scene
         //! Debug
         bool m_bShowDebug = false;
 
+        //! Persist baked tiles
+        bool m_bBakeEnabled = true;
+
+        //! Geometry hash of the last build, and of the last saved baked data
+        uint64_t m_geometryHash = 0;
+        uint64_t m_savedHash = 0;
+
+        //! Path of the last saved baked data
+        std::string m_savedPath;
+
+        //! Time-sliced path request
+        struct PathRequest
+        {
+            Vec3 start;
+            Vec3 end;
+            Vec3 extents;
+            dtQueryFilter filter;
+            int priority = 0;
+            EPathStatus status = EPathStatus::PENDING;
+            std::vector<NavPathPoint> points;
+
+            //! Updates since the request finished, uncollected results expire
+            int age = 0;
+
+            //! Search state, in navigation mesh space
+            Vec3 localStart;
+            Vec3 localEnd;
+            dtPolyRef endRef = 0;
+        };
+
+        //! Path requests by ticket
+        std::unordered_map<uint32_t, PathRequest> m_pathRequests;
+
+        //! Pending tickets ordered by priority, then by request order
+        std::set<std::pair<int, uint32_t>> m_pathQueue;
+
+        //! Running request, next ticket
+        uint32_t m_currentPath = 0;
+        uint32_t m_nextPathTicket = 1;
+
+        //! Query owning the sliced search state, and the mesh it was initialized with
+        dtNavMeshQuery *m_slicedQuery = nullptr;
+        dtNavMesh *m_slicedQueryMesh = nullptr;
+
+        //! Navigation mesh version when the running search started
+        uint32_t m_slicedQueryVersion = 0;
+
+        //! Sliced search iterations per update
+        int m_pathIterationBudget = 256;
+
+        //! Flow fields by goal, kept while agents reference them
+        std::vector<std::weak_ptr<NavFlowField>> m_flowFields;
+
+        //! Increased on every tile change, stale flow fields are rebuilt
+        uint32_t m_navMeshVersion = 0;
+
+        //! Polygon areas and built flags of one tile, valid while the tile salt and header match
+        struct PolyTableTile
+        {
+            uint32_t salt = 0;
+            const dtMeshHeader *header = nullptr;
+            std::vector<uint8_t> areas;
+            std::vector<uint16_t> flags;
+        };
+
+        //! Polygon table by tile index, and the navigation mesh version it was refreshed on
+        std::vector<PolyTableTile> m_polyTable;
+        uint32_t m_polyTableVersion = 0;
+
+        //! Area flag overrides
+        std::unordered_map<uint8_t, uint16_t> m_areaFlags;
+
+        //! Tiles queued for async rebuild, overlapping requests coalesce here
+        std::set<std::pair<int, int>> m_dirtyTiles;
+
+        //! Running async rebuild and its jobs
+        std::future<void> m_asyncBuild;
+        std::vector<std::unique_ptr<NavTileJob>> m_asyncJobs;
+
         //! Cache NavAgentManager
         std::weak_ptr<NavAgentManager> m_navAgentManager;
     };
@@ -63,12 +63,38 @@ namespace ige::scene
             getActivatedEvent().invoke(this);
     }
 
+    //! Shape of this obstacle
+    void NavObstacle::setShape(Shape shape)
+    {
+        if(m_bIsActivated)
+            getDeactivatedEvent().invoke(this);
+
+        m_shape = shape;
+
+        if(m_bIsActivated)
+            getActivatedEvent().invoke(this);
+    }
+
+    //! Box size
+    void NavObstacle::setSize(const Vec3 &size)
+    {
+        if(m_bIsActivated)
+            getDeactivatedEvent().invoke(this);
+
+        m_size = size;
+
+        if(m_bIsActivated)
+            getActivatedEvent().invoke(this);
+    }
+
     //! Serialize
     void NavObstacle::to_json(json &j) const
     {
         Component::to_json(j);
         j["radius"] = getRadius();
         j["height"] = getHeight();
+        j["shape"] = (int)getShape();
+        j["size"] = getSize();
     }
 
     //! Deserialize
@@ -76,6 +102,8 @@ namespace ige::scene
     {
         setRadius(j.value("radius", 1.f));
         setHeight(j.value("height", 1.f));
+        setShape((Shape)j.value("shape", (int)Shape::CYLINDER));
+        setSize(j.value("size", Vec3(1.f, 1.f, 1.f)));
         Component::from_json(j);
     }
 
@@ -99,6 +127,14 @@ namespace ige::scene
         {
             setHeight(val);
         }
+        else if(key.compare("shape") == 0)
+        {
+            setShape((Shape)val);
+        }
+        else if(key.compare("size") == 0)
+        {
+            setSize(val);
+        }
         else
         {
             Component::setProperty(key, val);
@@ -13,6 +13,15 @@ namespace ige::scene
     //! NavObstacle
     class NavObstacle : public Component
     {
+    public:
+        //! Obstacle shape
+        enum class Shape
+        {
+            CYLINDER = 0,
+            BOX,
+            ORIENTED_BOX
+        };
+
     public:
         //! Constructor
         NavObstacle(SceneObject& owner);
@@ -37,6 +46,14 @@ namespace ige::scene
         float getHeight() const { return m_height; }
         void setHeight(float height);
 
+        //! Shape of this obstacle. Cylinders use radius and height, boxes use size. Oriented boxes follow the owner yaw.
+        Shape getShape() const { return m_shape; }
+        void setShape(Shape shape);
+
+        //! Box size, the box stands on the owner position
+        const Vec3 &getSize() const { return m_size; }
+        void setSize(const Vec3 &size);
+
         //! Obstacle id received from tile cache.
         uint32_t getObstacleId() const { return m_obstacleId; }
         void setObstacleId(uint32_t id) { m_obstacleId = id; }
@@ -69,6 +86,12 @@ namespace ige::scene
         //! Height of this obstacle
         float m_height = 1.f;
 
+        //! Shape of this obstacle
+        Shape m_shape = Shape::CYLINDER;
+
+        //! Box size
+        Vec3 m_size = {1.f, 1.f, 1.f};
+
         //! Obstacle id received from tile cache.
         uint32_t m_obstacleId = 0;
 
@@ -0,0 +1,302 @@
+#include "components/physic/CharacterController.h"
+#include "components/physic/PhysicManager.h"
+#include "components/TransformComponent.h"
+#include "scene/Scene.h"
+#include "scene/SceneObject.h"
+
+#include "utils/PhysicHelper.h"
+
+#include <algorithm>
+
+namespace ige::scene
+{
+    //! Initialize static members
+    Event<CharacterController&> CharacterController::m_onActivatedEvent;
+    Event<CharacterController&> CharacterController::m_onDeactivatedEvent;
+
+    //! Constructor
+    CharacterController::CharacterController(SceneObject& owner)
+        : Component(owner)
+    {
+        // Register manager
+        if (!getOwner()->getScene()->isPrefab() && getOwner()->getRoot())
+        {
+            auto manager = getOwner()->getRoot()->getComponent<PhysicManager>();
+            if (manager == nullptr)
+                manager = getOwner()->getRoot()->addComponent<PhysicManager>();
+            setManager(manager);
+        }
+    }
+
+    //! Destructor
+    CharacterController::~CharacterController()
+    {
+        destroyController();
+        m_manager.reset();
+    }
+
+    //! Create controller
+    void CharacterController::createController()
+    {
+        destroyController();
+
+        m_shape = std::make_unique<btCapsuleShape>(m_radius, m_height);
+
+        btTransform transform;
+        transform.setIdentity();
+        transform.setOrigin(PhysicHelper::to_btVector3(getOwner()->getTransform()->getPosition() + m_offset));
+
+        m_ghostObject = std::make_unique<btPairCachingGhostObject>();
+        m_ghostObject->setWorldTransform(transform);
+        m_ghostObject->setCollisionShape(m_shape.get());
+        m_ghostObject->setCollisionFlags(btCollisionObject::CF_CHARACTER_OBJECT);
+        m_ghostObject->setUserPointer(this);
+
+        m_controller = std::make_unique<btKinematicCharacterController>(m_ghostObject.get(), m_shape.get(), m_stepHeight, btVector3(0.f, 1.f, 0.f));
+        m_controller->setMaxSlope(btRadians(m_maxSlope));
+        m_controller->setJumpSpeed(m_jumpSpeed);
+        m_controller->setFallSpeed(m_fallSpeed);
+        if (auto manager = getManager())
+            m_controller->setGravity(manager->getGravity());
+
+        m_syncedPosition = getOwner()->getTransform()->getPosition();
+    }
+
+    //! Destroy controller
+    void CharacterController::destroyController()
+    {
+        deactivate();
+        m_controller.reset();
+        m_ghostObject.reset();
+        m_shape.reset();
+    }
+
+    //! Activate
+    void CharacterController::activate()
+    {
+        if (!m_bIsActivated && m_controller)
+        {
+            getOnActivatedEvent().invoke(*this);
+            m_bIsActivated = true;
+        }
+    }
+
+    //! Deactivate
+    void CharacterController::deactivate()
+    {
+        if (m_bIsActivated)
+        {
+            getOnDeactivatedEvent().invoke(*this);
+            m_bIsActivated = false;
+        }
+    }
+
+    //! World cleared by the manager, activate again on the next update
+    void CharacterController::onWorldCleared()
+    {
+        m_bIsActivated = false;
+    }
+
+    //! Set enable
+    void CharacterController::setEnabled(bool enable)
+    {
+        Component::setEnabled(enable);
+        if (isEnabled())
+            activate();
+        else
+            deactivate();
+    }
+
+    //! Physic update
+    void CharacterController::onPhysicUpdate(float dt)
+    {
+        auto manager = getManager();
+        if (!manager || !manager->getWorld())
+            return;
+
+        if (!m_controller)
+            createController();
+
+        if (isEnabled() && !m_bIsActivated)
+            activate();
+
+        if (!m_bIsActivated)
+            return;
+
+        // Follow transform changes made outside of the simulation
+        const auto& position = getOwner()->getTransform()->getPosition();
+        auto delta = position - m_syncedPosition;
+        if (delta.LengthSqr() > 0.000001f)
+            warp(position);
+
+        // Bullet walk direction is a displacement per simulation step
+        m_controller->setWalkDirection(PhysicHelper::to_btVector3(m_velocity * manager->getFixedTimeStep()));
+    }
+
+    //! Sync the owner transform from the ghost object
+    void CharacterController::updateIgeTransform()
+    {
+        if (!m_ghostObject) return;
+        auto transform = getOwner()->getTransform();
+        transform->setPosition(PhysicHelper::from_btVector3(m_ghostObject->getWorldTransform().getOrigin()) - m_offset);
+        m_syncedPosition = transform->getPosition();
+    }
+
+    //! Move
+    void CharacterController::move(const Vec3& velocity)
+    {
+        m_velocity = velocity;
+    }
+
+    //! Jump
+    void CharacterController::jump(const Vec3& velocity)
+    {
+        if (m_controller && m_controller->canJump())
+            m_controller->jump(PhysicHelper::to_btVector3(velocity));
+    }
+
+    //! Grounded state
+    bool CharacterController::isGrounded() const
+    {
+        return m_controller && m_controller->onGround();
+    }
+
+    //! Teleport
+    void CharacterController::warp(const Vec3& position)
+    {
+        m_syncedPosition = position;
+        if (m_controller)
+        {
+            m_controller->warp(PhysicHelper::to_btVector3(position + m_offset));
+            auto manager = getManager();
+            if (m_bIsActivated && manager && manager->getWorld())
+                m_controller->reset(manager->getWorld());
+        }
+    }
+
+    //! Radius
+    void CharacterController::setRadius(float radius)
+    {
+        if (m_radius != radius)
+        {
+            m_radius = std::max(radius, 0.001f);
+            if (m_controller) createController();
+        }
+    }
+
+    //! Height
+    void CharacterController::setHeight(float height)
+    {
+        if (m_height != height)
+        {
+            m_height = std::max(height, 0.f);
+            if (m_controller) createController();
+        }
+    }
+
+    //! Step height
+    void CharacterController::setStepHeight(float height)
+    {
+        m_stepHeight = height;
+        if (m_controller) m_controller->setStepHeight(m_stepHeight);
+    }
+
+    //! Max slope
+    void CharacterController::setMaxSlope(float slope)
+    {
+        m_maxSlope = slope;
+        if (m_controller) m_controller->setMaxSlope(btRadians(m_maxSlope));
+    }
+
+    //! Jump speed
+    void CharacterController::setJumpSpeed(float speed)
+    {
+        m_jumpSpeed = speed;
+        if (m_controller) m_controller->setJumpSpeed(m_jumpSpeed);
+    }
+
+    //! Fall speed
+    void CharacterController::setFallSpeed(float speed)
+    {
+        m_fallSpeed = speed;
+        if (m_controller) m_controller->setFallSpeed(m_fallSpeed);
+    }
+
+    //! Offset
+    void CharacterController::setOffset(const Vec3& offset)
+    {
+        m_offset = offset;
+        if (m_controller) warp(getOwner()->getTransform()->getPosition());
+    }
+
+    //! Collision filter group
+    void CharacterController::setCollisionFilterGroup(int group)
+    {
+        m_collisionFilterGroup = group;
+        if (m_ghostObject && m_ghostObject->getBroadphaseHandle())
+            m_ghostObject->getBroadphaseHandle()->m_collisionFilterGroup = m_collisionFilterGroup;
+    }
+
+    //! Collision filter mask
+    void CharacterController::setCollisionFilterMask(int mask)
+    {
+        m_collisionFilterMask = mask;
+        if (m_ghostObject && m_ghostObject->getBroadphaseHandle())
+            m_ghostObject->getBroadphaseHandle()->m_collisionFilterMask = m_collisionFilterMask;
+    }
+
+    //! Serialize
+    void CharacterController::to_json(json& j) const
+    {
+        Component::to_json(j);
+        j["radius"] = getRadius();
+        j["height"] = getHeight();
+        j["step"] = getStepHeight();
+        j["slope"] = getMaxSlope();
+        j["jump"] = getJumpSpeed();
+        j["fall"] = getFallSpeed();
+        j["offset"] = getOffset();
+        j["group"] = getCollisionFilterGroup();
+        j["mask"] = getCollisionFilterMask();
+    }
+
+    //! Deserialize
+    void CharacterController::from_json(const json& j)
+    {
+        setRadius(j.value("radius", 0.5f));
+        setHeight(j.value("height", 1.f));
+        setStepHeight(j.value("step", 0.35f));
+        setMaxSlope(j.value("slope", 45.f));
+        setJumpSpeed(j.value("jump", 10.f));
+        setFallSpeed(j.value("fall", 55.f));
+        setOffset(j.value("offset", Vec3(0.f, 1.f, 0.f)));
+        setCollisionFilterGroup(j.value("group", (int)btBroadphaseProxy::DefaultFilter));
+        setCollisionFilterMask(j.value("mask", (int)btBroadphaseProxy::AllFilter));
+        Component::from_json(j);
+    }
+
+    //! Update property by key value
+    void CharacterController::setProperty(const std::string& key, const json& val)
+    {
+        if (key.compare("radius") == 0)
+            setRadius(val);
+        else if (key.compare("height") == 0)
+            setHeight(val);
+        else if (key.compare("step") == 0)
+            setStepHeight(val);
+        else if (key.compare("slope") == 0)
+            setMaxSlope(val);
+        else if (key.compare("jump") == 0)
+            setJumpSpeed(val);
+        else if (key.compare("fall") == 0)
+            setFallSpeed(val);
+        else if (key.compare("offset") == 0)
+            setOffset(val);
+        else if (key.compare("group") == 0)
+            setCollisionFilterGroup(val);
+        else if (key.compare("mask") == 0)
+            setCollisionFilterMask(val);
+        else
+            Component::setProperty(key, val);
+    }
+} // namespace ige::scene
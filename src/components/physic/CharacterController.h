@@ -0,0 +1,175 @@
+#pragma once
+
+#include "event/Event.h"
+#include "components/Component.h"
+
+#include "utils/PyxieHeaders.h"
+using namespace pyxie;
+
+#include <btBulletCollisionCommon.h>
+#include <BulletCollision/CollisionDispatch/btGhostObject.h>
+#include <BulletDynamics/Character/btKinematicCharacterController.h>
+
+namespace ige::scene
+{
+    class PhysicManager;
+
+    //! CharacterController: kinematic capsule character, the movement solve runs in Bullet's action step
+    class CharacterController : public Component
+    {
+    public:
+        //! Constructor
+        CharacterController(SceneObject& owner);
+
+        //! Destructor
+        virtual ~CharacterController();
+
+        //! Get name
+        std::string getName() const override { return "CharacterController"; }
+
+        //! Returns the type of the component
+        virtual Type getType() const override { return Type::CharacterController; }
+
+        //! Cache PhysicManager
+        std::shared_ptr<PhysicManager> getManager() const { return m_manager.expired() ? nullptr : m_manager.lock(); }
+        void setManager(std::shared_ptr<PhysicManager> manager) { m_manager = manager; }
+
+        //! Get ghost object
+        btPairCachingGhostObject* getGhostObject() const { return m_ghostObject.get(); }
+
+        //! Get Bullet controller
+        btKinematicCharacterController* getController() const { return m_controller.get(); }
+
+        //! Capsule radius
+        float getRadius() const { return m_radius; }
+        void setRadius(float radius);
+
+        //! Capsule height, without the caps
+        float getHeight() const { return m_height; }
+        void setHeight(float height);
+
+        //! Max height of steps to climb
+        float getStepHeight() const { return m_stepHeight; }
+        void setStepHeight(float height);
+
+        //! Max walkable slope, in degrees
+        float getMaxSlope() const { return m_maxSlope; }
+        void setMaxSlope(float slope);
+
+        //! Jump speed
+        float getJumpSpeed() const { return m_jumpSpeed; }
+        void setJumpSpeed(float speed);
+
+        //! Max fall speed
+        float getFallSpeed() const { return m_fallSpeed; }
+        void setFallSpeed(float speed);
+
+        //! Capsule center offset from the owner position
+        const Vec3& getOffset() const { return m_offset; }
+        void setOffset(const Vec3& offset);
+
+        //! Collision filter group
+        int getCollisionFilterGroup() const { return m_collisionFilterGroup; }
+        void setCollisionFilterGroup(int group);
+
+        //! Collision filter mask
+        int getCollisionFilterMask() const { return m_collisionFilterMask; }
+        void setCollisionFilterMask(int mask);
+
+        //! Move velocity, kept until changed
+        const Vec3& getVelocity() const { return m_velocity; }
+        void move(const Vec3& velocity);
+
+        //! Jump with the jump speed, or with the given velocity if not zero
+        void jump(const Vec3& velocity = {0.f, 0.f, 0.f});
+
+        //! Grounded state
+        bool isGrounded() const;
+
+        //! Teleport to the position
+        void warp(const Vec3& position);
+
+        //! Enable/Disable
+        virtual void setEnabled(bool enable = true) override;
+
+        //! Physic update: create on demand and follow transform changes
+        virtual void onPhysicUpdate(float dt) override;
+
+        //! Sync the owner transform from the ghost object
+        virtual void updateIgeTransform();
+
+        //! World cleared by the manager, activate again on the next update
+        void onWorldCleared();
+
+        //! Update property by key value
+        virtual void setProperty(const std::string& key, const json& val) override;
+
+        //! Activate/Deactivate events, handled by PhysicManager
+        static Event<CharacterController&>& getOnActivatedEvent() { return m_onActivatedEvent; }
+        static Event<CharacterController&>& getOnDeactivatedEvent() { return m_onDeactivatedEvent; }
+
+    protected:
+        //! Serialize
+        virtual void to_json(json& j) const override;
+
+        //! Deserialize
+        virtual void from_json(const json& j) override;
+
+        //! Create/Destroy controller
+        void createController();
+        void destroyController();
+
+        //! Activate/Deactivate
+        void activate();
+        void deactivate();
+
+    protected:
+        //! Events
+        static Event<CharacterController&> m_onActivatedEvent;
+        static Event<CharacterController&> m_onDeactivatedEvent;
+
+        //! Bullet objects
+        std::unique_ptr<btCapsuleShape> m_shape = nullptr;
+        std::unique_ptr<btPairCachingGhostObject> m_ghostObject = nullptr;
+        std::unique_ptr<btKinematicCharacterController> m_controller = nullptr;
+
+        //! Capsule radius
+        float m_radius = 0.5f;
+
+        //! Capsule height
+        float m_height = 1.f;
+
+        //! Step height
+        float m_stepHeight = 0.35f;
+
+        //! Max slope, in degrees
+        float m_maxSlope = 45.f;
+
+        //! Jump speed
+        float m_jumpSpeed = 10.f;
+
+        //! Max fall speed
+        float m_fallSpeed = 55.f;
+
+        //! Capsule offset
+        Vec3 m_offset = {0.f, 1.f, 0.f};
+
+        //! Collision filter group, default group so kinematic bodies (mask 3) still block the character
+        int m_collisionFilterGroup = btBroadphaseProxy::DefaultFilter;
+
+        //! Collision filter mask
+        int m_collisionFilterMask = btBroadphaseProxy::AllFilter;
+
+        //! Move velocity
+        Vec3 m_velocity = {0.f, 0.f, 0.f};
+
+        //! Position written by the last sync, other changes warp the controller
+        Vec3 m_syncedPosition = {0.f, 0.f, 0.f};
+
+        //! Cache activated status
+        bool m_bIsActivated = false;
+
+        //! Cache PhysicManager
+        std::weak_ptr<PhysicManager> m_manager;
+    };
+} // namespace ige::scene
@@ -34,7 +34,7 @@ namespace ige::scene
             rigidBody->recreateBody();
         }
         else {
-            if (getType() != Component::Type::MeshCollider && getType() != Component::Type::CompoundCollider) {
+            if (getType() != Component::Type::MeshCollider && getType() != Component::Type::HeightfieldCollider && getType() != Component::Type::CompoundCollider) {
                 auto compoundCollider = getOwner()->getFirstParentComponents<CompoundCollider>();
                 if (compoundCollider) {
                     compoundCollider->recreateShape();
@@ -63,7 +63,7 @@ namespace ige::scene
     //! Transform changed: update transform for kinematic object
     void Collider::onTransformChanged() {
         if (!SceneManager::hasInstance() || SceneManager::getInstance()->isPlaying()) return;
-        if (getType() != Component::Type::MeshCollider && getType() != Component::Type::CompoundCollider) {
+        if (getType() != Component::Type::MeshCollider && getType() != Component::Type::HeightfieldCollider && getType() != Component::Type::CompoundCollider) {
             auto compoundCollider = getOwner()->getFirstParentComponents<CompoundCollider>();
             if (compoundCollider) {
                 compoundCollider->recreateShape();
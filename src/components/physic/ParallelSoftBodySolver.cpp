@@ -0,0 +1,132 @@
+#include "components/physic/ParallelSoftBodySolver.h"
+
+#include <unordered_map>
+
+#include "utils/ThreadPool.h"
+
+namespace ige::scene
+{
+    //! Collect active soft bodies
+    void ParallelSoftBodySolver::collectActiveBodies()
+    {
+        m_activeBodies.clear();
+        for (int i = 0; i < m_softBodySet.size(); ++i)
+        {
+            if (m_softBodySet[i]->isActive())
+                m_activeBodies.push_back(m_softBodySet[i]);
+        }
+    }
+
+    //! Solve constraints: islands are independent, bodies of an island are solved in order
+    void ParallelSoftBodySolver::solveConstraints(btScalar solverdt)
+    {
+        if (!m_bParallel)
+        {
+            btDefaultSoftBodySolver::solveConstraints(solverdt);
+            return;
+        }
+
+        collectActiveBodies();
+        buildIslands();
+        ThreadPool::getInstance()->parallelFor((int)m_islands.size(), [this](int begin, int end) {
+            for (int i = begin; i < end; ++i)
+                for (auto body : m_islands[i])
+                    body->solveConstraints();
+        });
+    }
+
+    //! Integrate motion: soft bodies only touch their own nodes here
+    void ParallelSoftBodySolver::updateSoftBodies()
+    {
+        if (!m_bParallel)
+        {
+            btDefaultSoftBodySolver::updateSoftBodies();
+            return;
+        }
+
+        collectActiveBodies();
+        ThreadPool::getInstance()->parallelFor((int)m_activeBodies.size(), [this](int begin, int end) {
+            for (int i = begin; i < end; ++i)
+                m_activeBodies[i]->integrateMotion();
+        });
+    }
+
+    //! Find island root
+    int ParallelSoftBodySolver::findRoot(int idx)
+    {
+        while (m_parents[idx] != idx)
+        {
+            m_parents[idx] = m_parents[m_parents[idx]];
+            idx = m_parents[idx];
+        }
+        return idx;
+    }
+
+    //! Group active soft bodies which share dynamic rigid bodies or soft contacts
+    void ParallelSoftBodySolver::buildIslands()
+    {
+        const int numBodies = (int)m_activeBodies.size();
+        m_parents.resize(numBodies);
+        for (int i = 0; i < numBodies; ++i)
+            m_parents[i] = i;
+
+        auto unite = [this](int a, int b) {
+            a = findRoot(a);
+            b = findRoot(b);
+            if (a != b)
+                m_parents[b] = a;
+        };
+
+        // Impulses to static and kinematic bodies are discarded, only dynamic bodies link soft bodies
+        std::unordered_map<const btCollisionObject*, int> rigidOwners;
+        auto link = [&](const btCollisionObject* object, int bodyIdx) {
+            if (object == nullptr || object->isStaticOrKinematicObject())
+                return;
+            auto found = rigidOwners.emplace(object, bodyIdx);
+            if (!found.second)
+                unite(found.first->second, bodyIdx);
+        };
+
+        bool hasSoftContacts = false;
+        for (int i = 0; i < numBodies; ++i)
+        {
+            auto body = m_activeBodies[i];
+            for (int j = 0; j < body->m_rcontacts.size(); ++j)
+                link(body->m_rcontacts[j].m_cti.m_colObj, i);
+            for (int j = 0; j < body->m_anchors.size(); ++j)
+                link(body->m_anchors[j].m_body, i);
+            hasSoftContacts |= body->m_scontacts.size() > 0;
+        }
+
+        // Soft-soft contacts write nodes of both bodies but are stored on one side only,
+        // so keep every soft-soft colliding body in one island when such contacts exist
+        if (hasSoftContacts)
+        {
+            int first = -1;
+            for (int i = 0; i < numBodies; ++i)
+            {
+                auto body = m_activeBodies[i];
+                if (body->m_scontacts.size() == 0 && (body->m_cfg.collisions & btSoftBody::fCollision::SVSmask) == 0)
+                    continue;
+                if (first == -1)
+                    first = i;
+                else
+                    unite(first, i);
+            }
+        }
+
+        // Build islands, keeping the original solve order inside each island
+        m_islands.clear();
+        std::vector<int> islandIndices(numBodies, -1);
+        for (int i = 0; i < numBodies; ++i)
+        {
+            int root = findRoot(i);
+            if (islandIndices[root] == -1)
+            {
+                islandIndices[root] = (int)m_islands.size();
+                m_islands.emplace_back();
+            }
+            m_islands[islandIndices[root]].push_back(m_activeBodies[i]);
+        }
+    }
+} // namespace ige::scene
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+
+#include <BulletSoftBody/btSoftBody.h>
+#include <BulletSoftBody/btDefaultSoftBodySolver.h>
+
+namespace ige::scene
+{
+    //! ParallelSoftBodySolver: solve independent soft bodies on the worker pool.
+    //! Motion prediction stays serial, it updates the shared broadphase through btSoftBody::updateBounds().
+    //! Soft bodies sharing a dynamic rigid body, or touching each other, are solved serially in one island.
+    class ParallelSoftBodySolver : public btDefaultSoftBodySolver
+    {
+    public:
+        //! Enable/Disable parallel mode
+        bool isParallel() const { return m_bParallel; }
+        void setParallel(bool parallel = true) { m_bParallel = parallel; }
+
+        //! Solve constraints and contacts of active soft bodies
+        virtual void solveConstraints(btScalar solverdt) override;
+
+        //! Integrate motion of active soft bodies
+        virtual void updateSoftBodies() override;
+
+    protected:
+        //! Collect active soft bodies
+        void collectActiveBodies();
+
+        //! Group active soft bodies which share dynamic rigid bodies or soft contacts
+        void buildIslands();
+
+        //! Find island root
+        int findRoot(int idx);
+
+    protected:
+        //! Parallel mode
+        bool m_bParallel = false;
+
+        //! Active soft bodies of this step
+        std::vector<btSoftBody*> m_activeBodies;
+
+        //! Union-find parents
+        std::vector<int> m_parents;
+
+        //! Islands of soft bodies, solved in parallel
+        std::vector<std::vector<btSoftBody*>> m_islands;
+    };
+} // namespace ige::scene
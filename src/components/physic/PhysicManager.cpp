@@ -14,17 +14,26 @@
 #include <BulletSoftBody/btSoftBodyHelpers.h>
 #include <BulletSoftBody/btDeformableBodySolver.h>
 #include <BulletSoftBody/btSoftBodyRigidBodyCollisionConfiguration.h>
+#include <LinearMath/btQuickprof.h>
 
 #include "components/physic/Rigidbody.h"
 #include "components/physic/Softbody.h"
+#include "components/physic/collider/MeshCollider.h"
 #include "components/physic/BulletDebugRender.h"
 #include "scene/SceneManager.h"
 #include "utils/PhysicHelper.h"
 
+#include <chrono>
+#include <functional>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace ige::scene
 {
     //! Static member initialization
-    std::map< std::pair<Rigidbody*, Rigidbody*>, bool> PhysicManager::m_collisionEvents;
+    std::map< std::pair<Rigidbody*, Rigidbody*>, ContactPairState> PhysicManager::m_collisionEvents;
 
     //! Constructor
     PhysicManager::PhysicManager(SceneObject& owner, bool deformable)
@@ -42,7 +51,9 @@ namespace ige::scene
             m_dispatcher = std::make_unique<btCollisionDispatcher>(m_collisionConfiguration.get());
             m_broadphase = std::make_unique<btDbvtBroadphase>();
             m_solver = std::make_unique<btSequentialImpulseConstraintSolver>();
-            m_world = std::make_unique<btSoftRigidDynamicsWorld>(m_dispatcher.get(), m_broadphase.get(), m_solver.get(), m_collisionConfiguration.get());
+            m_softBodySolver = std::make_unique<ParallelSoftBodySolver>();
+            m_softBodySolver->setParallel(m_bParallelSoftBody);
+            m_world = std::make_unique<btSoftRigidDynamicsWorld>(m_dispatcher.get(), m_broadphase.get(), m_solver.get(), m_collisionConfiguration.get(), m_softBodySolver.get());
 
             auto& worldInfo = getDeformableWorld()->getWorldInfo();
             worldInfo.m_dispatcher = m_dispatcher.get();
@@ -55,17 +66,20 @@ namespace ige::scene
             m_collisionConfiguration = std::make_unique<btDefaultCollisionConfiguration>();
             m_dispatcher = std::make_unique<btCollisionDispatcher>(m_collisionConfiguration.get());
             m_broadphase = std::make_unique<btDbvtBroadphase>();
-            m_ghostPairCallback = std::make_unique<btGhostPairCallback>();
-            m_broadphase->getOverlappingPairCache()->setInternalGhostPairCallback(m_ghostPairCallback.get());
             m_solver = std::make_unique<btSequentialImpulseConstraintSolver>();
             m_world = std::make_unique<btDiscreteDynamicsWorld>(m_dispatcher.get(), m_broadphase.get(), m_solver.get(), m_collisionConfiguration.get());
         }
 
+        // Ghost objects (character controllers) track their overlapping pairs
+        m_ghostPairCallback = std::make_unique<btGhostPairCallback>();
+        m_broadphase->getOverlappingPairCache()->setInternalGhostPairCallback(m_ghostPairCallback.get());
+
         m_world->setGravity(m_gravity);
         m_world->getSolverInfo().m_numIterations = m_numIteration;
         m_world->getDispatchInfo().m_useContinuous = true;
         m_world->getSolverInfo().m_splitImpulse = false;
-        m_world->setSynchronizeAllMotionStates(true);
+        m_world->setSynchronizeAllMotionStates(false);
+        m_world->setInternalTickCallback(preTickCallback, this, true);
 
         // Set collision callback
         setCollisionCallback();
@@ -84,6 +98,10 @@ namespace ige::scene
         PhysicConstraint::getOnActivatedEvent().addListener(std::bind(static_cast<void(PhysicManager::*)(PhysicConstraint*)>(&PhysicManager::onActivated), this, std::placeholders::_1));
         PhysicConstraint::getOnDeactivatedEvent().addListener(std::bind(static_cast<void(PhysicManager::*)(PhysicConstraint*)>(&PhysicManager::onDeactivated), this, std::placeholders::_1));
 
+        // Character controller event listeners
+        CharacterController::getOnActivatedEvent().addListener(std::bind(static_cast<void(PhysicManager::*)(CharacterController&)>(&PhysicManager::onActivated), this, std::placeholders::_1));
+        CharacterController::getOnDeactivatedEvent().addListener(std::bind(static_cast<void(PhysicManager::*)(CharacterController&)>(&PhysicManager::onDeactivated), this, std::placeholders::_1));
+
         return true;
     }
 
@@ -106,10 +124,20 @@ namespace ige::scene
         PhysicConstraint::getOnActivatedEvent().removeAllListeners();
         PhysicConstraint::getOnDeactivatedEvent().removeAllListeners();
 
+        // Unregister character controller listeners
+        CharacterController::getOnActivatedEvent().removeAllListeners();
+        CharacterController::getOnDeactivatedEvent().removeAllListeners();
+
         // Destroy world
         if (m_world)
         {
             auto world = ((btDiscreteDynamicsWorld*)m_world.get());
+            for (auto character : m_characters)
+            {
+                world->removeAction(character->getController());
+                character->onWorldCleared();
+            }
+
             for (int i = world->getNumCollisionObjects() - 1; i >= 0; i--)
             {
                 auto obj = world->getCollisionObjectArray()[i];
@@ -129,7 +157,10 @@ namespace ige::scene
         }
 
         m_vehicles.clear();
+        m_characters.clear();
         m_collisionEvents.clear();
+        m_contactReports.clear();
+        m_movedBodies.clear();
 
         m_collisionConfiguration.reset();
         m_dispatcher.reset();
@@ -137,7 +168,13 @@ namespace ige::scene
         m_solver.reset();
         m_ghostPairCallback.reset();
         m_world.reset();
+        m_softBodySolver.reset();
         m_debugRenderer.reset();
+        m_softBodyGCCounter = 0;
+        m_accumulator = 0.f;
+
+        // Soft bodies of the unloaded scene are gone, do not reuse their welded meshes
+        Softbody::clearMeshCache();
     }
 
 
@@ -150,12 +187,22 @@ namespace ige::scene
         }
     }
 
+    // Set parallel soft body
+    void PhysicManager::setParallelSoftBody(bool parallel)
+    {
+        m_bParallelSoftBody = parallel;
+        if (m_softBodySolver)
+            m_softBodySolver->setParallel(m_bParallelSoftBody);
+    }
+
     // Set gravity
     void PhysicManager::setGravity(const btVector3& gravity)
     {
         m_gravity = gravity;
         if (m_world)
             m_world->setGravity(m_gravity);
+        for (auto character : m_characters)
+            character->getController()->setGravity(m_gravity);
     }
 
     //! Update
@@ -180,58 +227,131 @@ namespace ige::scene
         preUpdate();
 
         // Run simulation if not in edit mode
+        int numSteps = 0;
         if (SceneManager::getInstance()->isPlaying())
-              if (m_world->stepSimulation(dt * m_frameUpdateRatio, m_frameMaxSubStep, m_fixedTimeStep))
+        {
+            auto stepStart = std::chrono::high_resolution_clock::now();
+            numSteps = m_world->stepSimulation(dt * m_frameUpdateRatio, m_frameMaxSubStep, m_fixedTimeStep);
+            if (m_bProfiling)
+                collectProfile(std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - stepStart).count(), numSteps);
+            if (numSteps > 0)
                 postUpdate();
 
-        // Do GC
-        if(isDeformable() && getDeformableWorld())
-            getDeformableWorld()->getWorldInfo().m_sparsesdf.GarbageCollect();
+            // Interpolate moved bodies by the time left in the accumulator, mirroring the world local time
+            if (m_bInterpolation)
+            {
+                float alpha = 1.f;
+                if (m_frameMaxSubStep > 0 && m_fixedTimeStep > 0.f)
+                {
+                    m_accumulator += dt * m_frameUpdateRatio;
+                    if (m_accumulator >= m_fixedTimeStep)
+                        m_accumulator -= (int)(m_accumulator / m_fixedTimeStep) * m_fixedTimeStep;
+                    alpha = m_accumulator / m_fixedTimeStep;
+                }
+                for (auto body : m_movedBodies)
+                    body->interpolateIgeTransform(alpha);
+                m_movedBodies.clear();
+            }
+        }
+
+        // Do GC periodically, cells lifetime is counted in GC calls so scale it by the interval
+        if (numSteps > 0 && isDeformable() && getDeformableWorld())
+        {
+            m_softBodyGCCounter += numSteps;
+            if (m_softBodyGCCounter >= m_softBodyGCInterval)
+            {
+                getDeformableWorld()->getWorldInfo().m_sparsesdf.GarbageCollect(std::max(256 / m_softBodyGCInterval, 1));
+                m_softBodyGCCounter = 0;
+            }
+        }
     }
 
     void PhysicManager::preUpdate()
     {
         // Reset collision events
         for (auto& element : m_collisionEvents)
-            element.second = false;
+            element.second.bIsTouched = false;
+        m_contactReports.clear();
     }
 
     void PhysicManager::postUpdate()
     {
-        // Check remove collision events
+        // Build the contact report, pairs not touched anymore are removed
+        m_pendingContacts.clear();
         for (auto it = m_collisionEvents.begin(); it != m_collisionEvents.end();)
         {
             auto objects = it->first;
-            if (!it->second)
+            auto& state = it->second;
+            int event = !state.bIsTouched ? CONTACT_REPORT_EXIT : (state.bIsNew ? CONTACT_REPORT_ENTER : CONTACT_REPORT_STAY);
+            m_pendingContacts.push_back({objects.first, objects.second, event});
+
+            ContactReport report;
+            report.objectA = objects.first->getOwner()->getId();
+            report.objectB = objects.second->getOwner()->getId();
+            report.event = (uint32_t)event;
+            report.isTrigger = (objects.first->isTrigger() || objects.second->isTrigger()) ? 1 : 0;
+            for (int i = 0; i < 3; ++i)
+            {
+                report.point[i] = state.point[i];
+                report.normal[i] = state.normal[i];
+            }
+            m_contactReports.push_back(report);
+
+            if (event == CONTACT_REPORT_EXIT)
             {
-                if (!objects.first->isTrigger() && !objects.second->isTrigger())
-                {
-                    objects.first->getCollisionStopEvent().invoke(objects.second);
-                    objects.second->getCollisionStopEvent().invoke(objects.first);
-                }
-                else
-                {
-                    if (objects.first->isTrigger())
-                        objects.first->getTriggerStopEvent().invoke(objects.second);
-                    else
-                        objects.second->getTriggerStopEvent().invoke(objects.first);
-                }
                 it = m_collisionEvents.erase(it);
             }
             else
+            {
+                state.bIsNew = false;
                 ++it;
+            }
         }
 
-        // Update object transform
-        for (auto& body : m_rigidbodys) {
-            body.get().updateIgeTransform();
+        // Update transform of bodies moved by the simulation, sleeping bodies are skipped. Interpolated bodies are updated every frame instead.
+        if (!m_bInterpolation)
+        {
+            for (auto body : m_movedBodies)
+                body->updateIgeTransform();
+            m_movedBodies.clear();
+        }
+
+        // Update soft body nodes
+        for (auto& body : m_softbodys) {
+            auto softBody = body.get().getSoftBody();
+            if (softBody && softBody->isActive())
+                body.get().updateIgeTransform();
+        }
+
+        // Update transform of character controllers
+        for (auto character : m_characters)
+            character->updateIgeTransform();
+
+        // Dispatch after transforms are synced and the pair map is updated, listeners may destroy bodies (pending entries are reset then)
+        for (size_t i = 0; i < m_pendingContacts.size(); ++i)
+        {
+            auto contact = m_pendingContacts[i];
+            if (std::get<0>(contact) && std::get<1>(contact))
+                invokeContactEvents(std::get<0>(contact), std::get<1>(contact), std::get<2>(contact));
+            contact = m_pendingContacts[i];
+            if (std::get<0>(contact) && std::get<1>(contact))
+                invokeContactEvents(std::get<1>(contact), std::get<0>(contact), std::get<2>(contact));
         }
+        m_pendingContacts.clear();
+    }
+
+    //! Body moved by the simulation
+    void PhysicManager::onMoved(Rigidbody& object)
+    {
+        m_movedBodies.push_back(&object);
     }
 
     //! Create/Destroy event
     void PhysicManager::onCreated(Rigidbody& object)
     {
         m_rigidbodys.push_back(std::ref(object));
+        if (object.getType() == Component::Type::Softbody)
+            m_softbodys.push_back(std::ref(object));
     }
 
     void PhysicManager::onDestroyed(Rigidbody& object)
@@ -245,7 +365,25 @@ namespace ige::scene
 
         if (found != m_rigidbodys.end()) {
             m_rigidbodys.erase(found);
-        }           
+        }
+
+        auto softFound = std::find_if(m_softbodys.begin(), m_softbodys.end(), [bodyId](const auto& element) {
+            return element.get().getInstanceId() == bodyId;
+        });
+
+        if (softFound != m_softbodys.end()) {
+            m_softbodys.erase(softFound);
+        }
+
+        // Remove pending transform sync
+        m_movedBodies.erase(std::remove(m_movedBodies.begin(), m_movedBodies.end(), &object), m_movedBodies.end());
+
+        // Reset pending contact events, keep indices stable for the running dispatch
+        for (auto& contact : m_pendingContacts)
+        {
+            if (std::get<0>(contact) == &object || std::get<1>(contact) == &object)
+                contact = {nullptr, nullptr, CONTACT_REPORT_NONE};
+        }
 
         // Find and remove collision events
         auto evFound = std::find_if(m_collisionEvents.begin(), m_collisionEvents.end(), [bodyId](auto pair) {
@@ -296,6 +434,41 @@ namespace ige::scene
         }
     }
 
+    //! Character controller activated event
+    void PhysicManager::onActivated(CharacterController& character)
+    {
+        if (!m_world || !character.getController())
+            return;
+        m_world->addCollisionObject(character.getGhostObject(), character.getCollisionFilterGroup(), character.getCollisionFilterMask());
+        m_world->addAction(character.getController());
+        character.getController()->setGravity(m_gravity);
+        m_characters.push_back(&character);
+    }
+
+    //! Character controller deactivated event
+    void PhysicManager::onDeactivated(CharacterController& character)
+    {
+        auto found = std::find(m_characters.begin(), m_characters.end(), &character);
+        if (found == m_characters.end())
+            return;
+        m_characters.erase(found);
+        if (m_world)
+        {
+            m_world->removeAction(character.getController());
+            m_world->removeCollisionObject(character.getGhostObject());
+        }
+    }
+
+    //! Scene object of a collision object
+    SceneObject* PhysicManager::getSceneObject(const btCollisionObject* object)
+    {
+        if (object == nullptr || object->getUserPointer() == nullptr)
+            return nullptr;
+        if (object->getInternalType() == btCollisionObject::CO_GHOST_OBJECT)
+            return reinterpret_cast<CharacterController*>(object->getUserPointer())->getOwner();
+        return reinterpret_cast<Rigidbody*>(object->getUserPointer())->getOwner();
+    }
+
     //! Constraint activated event
     void PhysicManager::onActivated(PhysicConstraint *constraint)
     {
@@ -396,75 +569,530 @@ namespace ige::scene
         auto object1 = reinterpret_cast<Rigidbody *>(obj1->getCollisionObject()->getUserPointer());
         auto object2 = reinterpret_cast<Rigidbody *>(obj2->getCollisionObject()->getUserPointer());
 
-        if (object1 && object2)
+        // Skip pairs without reporting bodies, and trigger-trigger pairs. Character ghosts are not Rigidbody.
+        if (obj1->getCollisionObject()->getInternalType() == btCollisionObject::CO_GHOST_OBJECT || obj2->getCollisionObject()->getInternalType() == btCollisionObject::CO_GHOST_OBJECT)
+            return false;
+        if (!object1 || !object2)
+            return false;
+        if (object1->getActiveReportFlags() == CONTACT_REPORT_NONE && object2->getActiveReportFlags() == CONTACT_REPORT_NONE)
+            return false;
+        if (object1->isTrigger() && object2->isTrigger())
+            return false;
+
+        // Only record the pair here, events are dispatched once per frame in postUpdate
+        auto& state = m_collisionEvents[{object1, object2}];
+        if (!state.bIsTouched)
         {
-            /* If the objects are not all trigger, enter */
-            if (!object1->isTrigger() || !object2->isTrigger())
+            state.bIsTouched = true;
+            state.point = cp.getPositionWorldOnB();
+            state.normal = cp.m_normalWorldOnB;
+        }
+        return false;
+    }
+
+    //! Profiling
+    void PhysicManager::setProfiling(bool profiling)
+    {
+        m_bProfiling = profiling;
+        m_profileFrames = 0;
+        m_profileSteps = 0;
+        m_profileTime = 0.0;
+        m_profilePhases.clear();
+    }
+
+    //! Accumulate Bullet profile timings, the profile tree is reset by every stepSimulation call
+    void PhysicManager::collectProfile(float stepTime, int numSteps)
+    {
+        m_profileFrames++;
+        m_profileSteps += numSteps;
+        m_profileTime += stepTime;
+
+#ifndef BT_NO_PROFILE
+        std::function<void(CProfileIterator*, const std::string&)> collect = [&](CProfileIterator* it, const std::string& parent) {
+            int numChildren = 0;
+            for (it->First(); !it->Is_Done(); it->Next())
+                numChildren++;
+            for (int index = 0; index < numChildren; ++index)
             {
-                if (m_collisionEvents.find({object1, object2}) == m_collisionEvents.end())
+                // Entering a child and back resets the iterator, so seek to the child each time
+                it->First();
+                for (int i = 0; i < index; ++i)
+                    it->Next();
+                auto path = parent.empty() ? std::string(it->Get_Current_Name()) : parent + "/" + it->Get_Current_Name();
+                auto& phase = m_profilePhases[path];
+                phase.first += it->Get_Current_Total_Time();
+                phase.second += it->Get_Current_Total_Calls();
+                it->Enter_Child(index);
+                collect(it, path);
+                it->Enter_Parent();
+            }
+        };
+        auto iterator = CProfileManager::Get_Iterator();
+        if (iterator)
+        {
+            collect(iterator, "");
+            CProfileManager::Release_Iterator(iterator);
+        }
+#endif
+    }
+
+    //! Profile report
+    json PhysicManager::getProfileReport() const
+    {
+        auto phases = json::object();
+        for (const auto& phase : m_profilePhases)
+            phases[phase.first] = json{{"time", phase.second.first}, {"calls", phase.second.second}};
+        return json{
+            {"frames", m_profileFrames},
+            {"steps", m_profileSteps},
+            {"time", m_profileTime},
+            {"stepsPerSec", m_profileTime > 0.0 ? m_profileSteps * 1000.0 / m_profileTime : 0.0},
+            {"phases", phases},
+        };
+    }
+
+    //! Pre-tick callback
+    void PhysicManager::preTickCallback(btDynamicsWorld* world, btScalar timeStep)
+    {
+        auto manager = reinterpret_cast<PhysicManager*>(world->getWorldUserInfo());
+        if (manager == nullptr || !manager->m_bInterpolation)
+            return;
+        for (auto& body : manager->m_rigidbodys)
+        {
+            auto btBody = body.get().getBody();
+            if (btBody && btBody->isActive())
+                body.get().savePreviousTransform();
+        }
+    }
+
+    //! Invoke contact events of the body, filtered by its report flags
+    void PhysicManager::invokeContactEvents(Rigidbody* body, Rigidbody* other, int event)
+    {
+        /*
+        *  If body is trigger, invoke Trigger event,
+        *  else : is the other object trigger?
+        *    yes -> do nothing
+        *    no -> invoke Collision event
+        */
+        if (!body->isTrigger() && other->isTrigger())
+            return;
+
+        int flags = body->getActiveReportFlags() & event;
+        if (event == CONTACT_REPORT_ENTER)
+            flags |= body->getActiveReportFlags() & CONTACT_REPORT_STAY;
+        if (flags == CONTACT_REPORT_NONE)
+            return;
+
+        if (body->isTrigger())
+        {
+            if (flags & CONTACT_REPORT_ENTER) body->getTriggerStartEvent().invoke(other);
+            if (flags & CONTACT_REPORT_STAY) body->getTriggerStayEvent().invoke(other);
+            if (flags & CONTACT_REPORT_EXIT) body->getTriggerStopEvent().invoke(other);
+        }
+        else
+        {
+            if (flags & CONTACT_REPORT_ENTER) body->getCollisionStartEvent().invoke(other);
+            if (flags & CONTACT_REPORT_STAY) body->getCollisionStayEvent().invoke(other);
+            if (flags & CONTACT_REPORT_EXIT) body->getCollisionStopEvent().invoke(other);
+        }
+    }
+
+    void PhysicManager::setCollisionCallback()
+    {
+        gContactAddedCallback = &PhysicManager::collisionCallback;
+    }
+
+    //! Snapshot format
+    static constexpr uint32_t SNAPSHOT_MAGIC = 0x53504749; // "IGPS"
+    static constexpr uint32_t SNAPSHOT_VERSION = 2;
+
+    enum SnapshotRecord : uint8_t
+    {
+        SNAPSHOT_RIGIDBODY = 0,
+        SNAPSHOT_SOFTBODY,
+        SNAPSHOT_CHARACTER,
+    };
+
+    //! Snapshot writer/reader helpers
+    template <typename T>
+    static void writeSnapshot(std::vector<uint8_t>& data, const T& value)
+    {
+        auto size = data.size();
+        data.resize(size + sizeof(T));
+        memcpy(data.data() + size, &value, sizeof(T));
+    }
+
+    static void writeSnapshot(std::vector<uint8_t>& data, const btVector3& value)
+    {
+        for (int i = 0; i < 3; ++i)
+            writeSnapshot(data, (float)value[i]);
+    }
+
+    template <typename T>
+    static bool readSnapshot(const std::vector<uint8_t>& data, size_t& offset, T& value)
+    {
+        if (offset + sizeof(T) > data.size())
+            return false;
+        memcpy(&value, data.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    static bool readSnapshot(const std::vector<uint8_t>& data, size_t& offset, btVector3& value)
+    {
+        float v[3];
+        if (!readSnapshot(data, offset, v))
+            return false;
+        value.setValue(v[0], v[1], v[2]);
+        return true;
+    }
+
+    static bool readSnapshotHeader(const std::vector<uint8_t>& data, size_t& offset)
+    {
+        uint32_t magic = 0, version = 0;
+        return readSnapshot(data, offset, magic) && magic == SNAPSHOT_MAGIC
+            && readSnapshot(data, offset, version) && version == SNAPSHOT_VERSION;
+    }
+
+    static bool readSnapshotFile(const std::string& path, std::vector<uint8_t>& data)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+            return false;
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    //! Record type of a collision object, a scene object may own several of them
+    static SnapshotRecord getSnapshotRecord(const btCollisionObject* object)
+    {
+        if (object->getInternalType() == btCollisionObject::CO_GHOST_OBJECT)
+            return SNAPSHOT_CHARACTER;
+        if (btSoftBody::upcast(object))
+            return SNAPSHOT_SOFTBODY;
+        return SNAPSHOT_RIGIDBODY;
+    }
+
+    //! Write baked mesh collider shapes, prefixed by the section size so restoreSnapshot() can skip them
+    static void writeSnapshotShapes(std::vector<uint8_t>& data, const btCollisionObjectArray& objects)
+    {
+        auto sectionOffset = data.size();
+        writeSnapshot(data, (uint32_t)0);
+        writeSnapshot(data, (uint32_t)0);
+
+        uint32_t numShapes = 0;
+        std::unordered_set<std::string> bakedOwners;
+        MeshCollider::BakedShape shape;
+        for (int i = 0; i < objects.size(); ++i)
+        {
+            auto owner = PhysicManager::getSceneObject(objects[i]);
+            if (owner == nullptr || !bakedOwners.insert(owner->getUUID()).second)
+                continue;
+            auto collider = owner->getComponent<MeshCollider>();
+            if (collider == nullptr || !collider->bakeShape(shape))
+                continue;
+
+            const auto& uuid = owner->getUUID();
+            writeSnapshot(data, (uint16_t)uuid.size());
+            data.insert(data.end(), uuid.begin(), uuid.end());
+            writeSnapshot(data, (int32_t)shape.meshIndex);
+            writeSnapshot(data, (int32_t)shape.numMesh);
+            writeSnapshot(data, (uint8_t)shape.convex);
+            writeSnapshot(data, (uint32_t)shape.points.size());
+            for (size_t n = 0; n < shape.points.size(); ++n)
+            {
+                writeSnapshot(data, (uint32_t)shape.points[n].size());
+                for (const auto& point : shape.points[n])
+                    writeSnapshot(data, point);
+                const auto* indices = (n < shape.indices.size()) ? &shape.indices[n] : nullptr;
+                writeSnapshot(data, (uint32_t)(indices ? indices->size() : 0));
+                if (indices && !indices->empty())
+                {
+                    auto bytes = (const uint8_t*)indices->data();
+                    data.insert(data.end(), bytes, bytes + indices->size() * sizeof(int32_t));
+                }
+            }
+            ++numShapes;
+        }
+
+        auto sectionSize = (uint32_t)(data.size() - sectionOffset - sizeof(uint32_t));
+        memcpy(data.data() + sectionOffset, &sectionSize, sizeof(uint32_t));
+        memcpy(data.data() + sectionOffset + sizeof(uint32_t), &numShapes, sizeof(uint32_t));
+    }
+
+    //! Read baked mesh collider shapes and register them to MeshCollider, or skip them
+    static bool readSnapshotShapes(const std::vector<uint8_t>& data, size_t& offset, bool registerShapes)
+    {
+        uint32_t sectionSize = 0, numShapes = 0;
+        if (!readSnapshot(data, offset, sectionSize) || offset + sectionSize > data.size())
+            return false;
+        auto end = offset + sectionSize;
+        if (!registerShapes)
+        {
+            offset = end;
+            return true;
+        }
+        if (!readSnapshot(data, offset, numShapes))
+            return false;
+
+        std::string uuid;
+        for (uint32_t i = 0; i < numShapes; ++i)
+        {
+            uint16_t uuidSize = 0;
+            if (!readSnapshot(data, offset, uuidSize) || offset + uuidSize > end)
+                return false;
+            uuid.assign((const char*)data.data() + offset, uuidSize);
+            offset += uuidSize;
+
+            int32_t meshIndex = 0, numMesh = 0;
+            uint8_t convex = 0;
+            uint32_t numSubShapes = 0;
+            if (!readSnapshot(data, offset, meshIndex) || !readSnapshot(data, offset, numMesh) || !readSnapshot(data, offset, convex)
+                || !readSnapshot(data, offset, numSubShapes) || numSubShapes > sectionSize)
+                return false;
+
+            MeshCollider::BakedShape shape;
+            shape.meshIndex = meshIndex;
+            shape.numMesh = numMesh;
+            shape.convex = convex != 0;
+            shape.points.resize(numSubShapes);
+            shape.indices.resize(numSubShapes);
+            for (uint32_t n = 0; n < numSubShapes; ++n)
+            {
+                uint32_t numPoints = 0, numIndices = 0;
+                if (!readSnapshot(data, offset, numPoints) || offset + (size_t)numPoints * sizeof(float) * 3 > end)
+                    return false;
+                shape.points[n].resize(numPoints);
+                for (auto& point : shape.points[n])
+                    readSnapshot(data, offset, point);
+                if (!readSnapshot(data, offset, numIndices) || offset + (size_t)numIndices * sizeof(int32_t) > end)
+                    return false;
+                shape.indices[n].resize(numIndices);
+                if (numIndices > 0)
+                    memcpy(shape.indices[n].data(), data.data() + offset, numIndices * sizeof(int32_t));
+                offset += numIndices * sizeof(int32_t);
+            }
+            MeshCollider::addBakedShape(uuid, std::move(shape));
+        }
+        offset = end;
+        return true;
+    }
+
+    //! Save snapshot
+    void PhysicManager::saveSnapshot(std::vector<uint8_t>& data)
+    {
+        data.clear();
+        writeSnapshot(data, SNAPSHOT_MAGIC);
+        writeSnapshot(data, SNAPSHOT_VERSION);
+        if (!m_world)
+        {
+            writeSnapshotShapes(data, btCollisionObjectArray());
+            writeSnapshot(data, (uint32_t)0);
+            return;
+        }
+
+        const auto& objects = m_world->getCollisionObjectArray();
+        writeSnapshotShapes(data, objects);
+        writeSnapshot(data, (uint32_t)objects.size());
+        for (int i = 0; i < objects.size(); ++i)
+        {
+            auto object = objects[i];
+            auto owner = getSceneObject(object);
+            if (owner == nullptr)
+            {
+                writeSnapshot(data, (uint16_t)0);
+                continue;
+            }
+            const auto& uuid = owner->getUUID();
+            writeSnapshot(data, (uint16_t)uuid.size());
+            data.insert(data.end(), uuid.begin(), uuid.end());
+
+            if (object->getInternalType() == btCollisionObject::CO_GHOST_OBJECT)
+            {
+                auto character = reinterpret_cast<CharacterController*>(object->getUserPointer());
+                writeSnapshot(data, (uint8_t)SNAPSHOT_CHARACTER);
+                writeSnapshot(data, object->getWorldTransform().getOrigin());
+                writeSnapshot(data, PhysicHelper::to_btVector3(character->getVelocity()));
+                continue;
+            }
+
+            const auto& transform = object->getWorldTransform();
+            auto rotation = transform.getRotation();
+            if (auto softBody = btSoftBody::upcast(object))
+            {
+                writeSnapshot(data, (uint8_t)SNAPSHOT_SOFTBODY);
+                writeSnapshot(data, (int32_t)object->getActivationState());
+                writeSnapshot(data, (uint32_t)softBody->m_nodes.size());
+                for (int n = 0; n < softBody->m_nodes.size(); ++n)
+                {
+                    writeSnapshot(data, softBody->m_nodes[n].m_x);
+                    writeSnapshot(data, softBody->m_nodes[n].m_v);
+                }
+                continue;
+            }
+
+            auto body = btRigidBody::upcast(object);
+            writeSnapshot(data, (uint8_t)SNAPSHOT_RIGIDBODY);
+            writeSnapshot(data, (int32_t)object->getActivationState());
+            writeSnapshot(data, transform.getOrigin());
+            float quat[4] = {(float)rotation.x(), (float)rotation.y(), (float)rotation.z(), (float)rotation.w()};
+            writeSnapshot(data, quat);
+            writeSnapshot(data, body ? body->getLinearVelocity() : btVector3(0.f, 0.f, 0.f));
+            writeSnapshot(data, body ? body->getAngularVelocity() : btVector3(0.f, 0.f, 0.f));
+        }
+    }
+
+    //! Restore snapshot, bodies not found in the world are skipped
+    bool PhysicManager::restoreSnapshot(const std::vector<uint8_t>& data)
+    {
+        if (!m_world)
+            return false;
+
+        // Shapes are already built by the colliders, only body states are restored
+        size_t offset = 0;
+        uint32_t count = 0;
+        if (!readSnapshotHeader(data, offset) || !readSnapshotShapes(data, offset, false))
+            return false;
+        if (!readSnapshot(data, offset, count))
+            return false;
+
+        // Map UUID and record type to collision objects of the current world
+        std::unordered_map<std::string, btCollisionObject*> objects;
+        const auto& objectArray = m_world->getCollisionObjectArray();
+        objects.reserve(objectArray.size());
+        for (int i = 0; i < objectArray.size(); ++i)
+        {
+            if (auto owner = getSceneObject(objectArray[i]))
+                objects[owner->getUUID() + (char)getSnapshotRecord(objectArray[i])] = objectArray[i];
+        }
+
+        std::string uuid;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint16_t uuidSize = 0;
+            if (!readSnapshot(data, offset, uuidSize) || offset + uuidSize > data.size())
+                return false;
+            if (uuidSize == 0)
+                continue;
+            uuid.assign((const char*)data.data() + offset, uuidSize);
+            offset += uuidSize;
+
+            uint8_t type = 0;
+            if (!readSnapshot(data, offset, type))
+                return false;
+            auto found = objects.find(uuid + (char)type);
+            auto object = (found != objects.end()) ? found->second : nullptr;
+
+            if (type == SNAPSHOT_CHARACTER)
+            {
+                btVector3 position, velocity;
+                if (!readSnapshot(data, offset, position) || !readSnapshot(data, offset, velocity))
+                    return false;
+                if (object && object->getInternalType() == btCollisionObject::CO_GHOST_OBJECT)
+                {
+                    auto character = reinterpret_cast<CharacterController*>(object->getUserPointer());
+                    character->warp(PhysicHelper::from_btVector3(position) - character->getOffset());
+                    character->move(PhysicHelper::from_btVector3(velocity));
+                    character->updateIgeTransform();
+                }
+            }
+            else if (type == SNAPSHOT_SOFTBODY)
+            {
+                int32_t state = 0;
+                uint32_t numNodes = 0;
+                if (!readSnapshot(data, offset, state) || !readSnapshot(data, offset, numNodes))
+                    return false;
+                if (offset + (size_t)numNodes * sizeof(float) * 6 > data.size())
+                    return false;
+                auto softBody = object ? btSoftBody::upcast(object) : nullptr;
+                if (softBody == nullptr || softBody->m_nodes.size() != (int)numNodes)
                 {
-                    /*
-                    *  If object is trigger, invoke Trigger event,
-                    *  else : is the other object trigger?
-                    *    yes -> do nothing
-                    *    no -> invoke Collision event
-                    */
-
-                    // Object 1 (Start event)
-                    if (object1->isTrigger())
-                        object1->getTriggerStartEvent().invoke(object2);
-                    else if (!object2->isTrigger())
-                        object1->getCollisionStartEvent().invoke(object2);
-
-                    // Object 2 (Start event)
-                    if (object2->isTrigger())
-                        object2->getTriggerStartEvent().invoke(object1);
-                    else if (!object1->isTrigger())
-                        object2->getCollisionStartEvent().invoke(object1);
-
-                    // Object 1 (Stay event)
-                    if (object1->isTrigger())
-                        object1->getTriggerStayEvent().invoke(object2);
-                    else if (!object2->isTrigger())
-                        object1->getCollisionStayEvent().invoke(object2);
-
-                    // Object 2 (Stay event)
-                    if (object2->isTrigger())
-                        object2->getTriggerStayEvent().invoke(object1);
-                    else if (!object1->isTrigger())
-                        object2->getCollisionStayEvent().invoke(object1);
-
-                    m_collisionEvents[{object1, object2}] = true;
-                    return true;
+                    offset += (size_t)numNodes * sizeof(float) * 6;
+                    continue;
                 }
-                else
+                for (uint32_t n = 0; n < numNodes; ++n)
                 {
-                    if (!m_collisionEvents[{object1, object2}])
-                    {
-                        // Object 1 (Stay event)
-                        if (object1->isTrigger())
-                            object1->getTriggerStayEvent().invoke(object2);
-                        else if (!object2->isTrigger())
-                            object1->getCollisionStayEvent().invoke(object2);
-
-                        // Object 2 (Stay event)
-                        if (object2->isTrigger())
-                            object2->getTriggerStayEvent().invoke(object1);
-                        else if (!object1->isTrigger())
-                            object2->getCollisionStayEvent().invoke(object1);
-
-                        m_collisionEvents[{object1, object2}] = true;
-                        return true;
-                    }
+                    auto& node = softBody->m_nodes[n];
+                    readSnapshot(data, offset, node.m_x);
+                    readSnapshot(data, offset, node.m_v);
+                    node.m_q = node.m_x;
+                    node.m_f.setZero();
                 }
+                softBody->updateBounds();
+                softBody->forceActivationState(state);
+                m_world->updateSingleAabb(softBody);
+                auto rigidbody = reinterpret_cast<Rigidbody*>(softBody->getUserPointer());
+                rigidbody->savePreviousTransform();
+                rigidbody->updateIgeTransform();
+            }
+            else if (type == SNAPSHOT_RIGIDBODY)
+            {
+                int32_t state = 0;
+                btVector3 position, linearVelocity, angularVelocity;
+                float rotation[4];
+                if (!readSnapshot(data, offset, state) || !readSnapshot(data, offset, position) || !readSnapshot(data, offset, rotation)
+                    || !readSnapshot(data, offset, linearVelocity) || !readSnapshot(data, offset, angularVelocity))
+                    return false;
+                auto body = object ? btRigidBody::upcast(object) : nullptr;
+                if (body == nullptr)
+                    continue;
+
+                btTransform transform(btQuaternion(rotation[0], rotation[1], rotation[2], rotation[3]), position);
+                body->setWorldTransform(transform);
+                body->setInterpolationWorldTransform(transform);
+                if (body->getMotionState())
+                    body->getMotionState()->setWorldTransform(transform);
+                body->setLinearVelocity(linearVelocity);
+                body->setAngularVelocity(angularVelocity);
+                body->setInterpolationLinearVelocity(linearVelocity);
+                body->setInterpolationAngularVelocity(angularVelocity);
+                body->clearForces();
+                body->forceActivationState(state);
+                m_world->updateSingleAabb(body);
+
+                // Restart interpolation from the restored pose
+                auto rigidbody = reinterpret_cast<Rigidbody*>(body->getUserPointer());
+                rigidbody->savePreviousTransform();
+                rigidbody->updateIgeTransform();
+            }
+            else
+            {
+                return false;
             }
         }
-        return false;
+        return true;
     }
 
-    void PhysicManager::setCollisionCallback()
+    //! Save snapshot file
+    bool PhysicManager::saveSnapshot(const std::string& path)
     {
-        gContactAddedCallback = &PhysicManager::collisionCallback;
+        std::vector<uint8_t> data;
+        saveSnapshot(data);
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open())
+            return false;
+        file.write((const char*)data.data(), data.size());
+        return file.good();
+    }
+
+    //! Load snapshot file
+    bool PhysicManager::loadSnapshot(const std::string& path)
+    {
+        std::vector<uint8_t> data;
+        return readSnapshotFile(path, data) && restoreSnapshot(data);
+    }
+
+    //! Preload baked shapes of a snapshot, before the scene is loaded
+    bool PhysicManager::preloadSnapshot(const std::vector<uint8_t>& data)
+    {
+        size_t offset = 0;
+        return readSnapshotHeader(data, offset) && readSnapshotShapes(data, offset, true);
+    }
+
+    bool PhysicManager::preloadSnapshot(const std::string& path)
+    {
+        std::vector<uint8_t> data;
+        return readSnapshotFile(path, data) && preloadSnapshot(data);
     }
 
     //! Serialize
@@ -475,6 +1103,9 @@ namespace ige::scene
         j["numIter"] = getNumIteration();
         j["timeStep"] = getFixedTimeStep();
         j["maxSupStep"] = getFrameMaxSubStep();
+        j["parSoft"] = isParallelSoftBody();
+        j["sdfGC"] = getSoftBodyGCInterval();
+        j["interp"] = isInterpolation();
         j["timeRatio"] = getFrameUpdateRatio();
         j["gravity"] = PhysicHelper::from_btVector3(getGravity());
         j["debug"] = isShowDebug();
@@ -487,6 +1118,9 @@ namespace ige::scene
         setNumIteration(j.value("numIter", 1));
         setFixedTimeStep(j.value("timeStep", 1 / 60.f));
         setFrameMaxSubStep(j.value("maxSupStep", 1));
+        setParallelSoftBody(j.value("parSoft", false));
+        setSoftBodyGCInterval(j.value("sdfGC", 16));
+        setInterpolation(j.value("interp", false));
         setFrameUpdateRatio(j.value("timeRatio", 1.f));
         setGravity(PhysicHelper::to_btVector3(j.value("gravity", Vec3(0.f, -9.81f, 0.f))));
         setShowDebug(j.value("debug", false));
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include <string>
 #include <tuple>
+#include <map>
 
 #include <btBulletDynamicsCommon.h>
 #include <btBulletCollisionCommon.h>
@@ -15,7 +17,9 @@
 #include "components/physic/Rigidbody.h"
 #include "components/physic/Softbody.h"
 #include "components/physic/PhysicConstraint.h"
+#include "components/physic/CharacterController.h"
 #include "components/physic/BulletDebugRender.h"
+#include "components/physic/ParallelSoftBodySolver.h"
 
 #include "utils/Singleton.h"
 #include "event/Event.h"
@@ -40,6 +44,34 @@ namespace ige::scene
         btVector3 normalB;
     };
 
+    //! Contact report record of one pair per frame, plain data so scripts can read the list as a flat buffer
+    struct ContactReport
+    {
+        //! Scene object ids
+        uint64_t objectA;
+        uint64_t objectB;
+
+        //! ContactReportFlag: enter, stay or exit
+        uint32_t event;
+
+        //! One of the bodies is a trigger
+        uint32_t isTrigger;
+
+        //! First contact point and normal on B, in world space
+        float point[3];
+        float normal[3];
+    };
+    static_assert(sizeof(ContactReport) == 48, "ContactReport is exposed as packed records");
+
+    //! Contact pair state, refreshed by the collision callback
+    struct ContactPairState
+    {
+        bool bIsTouched = false;
+        bool bIsNew = true;
+        btVector3 point = {0.f, 0.f, 0.f};
+        btVector3 normal = {0.f, 0.f, 0.f};
+    };
+
     struct ContactResultCB : public btCollisionWorld::ContactResultCallback
     {
         int count;
@@ -121,6 +153,25 @@ namespace ige::scene
         float getFixedTimeStep() const { return m_fixedTimeStep; }
         void setFixedTimeStep(float timeStep) { m_fixedTimeStep = timeStep; }
 
+        //! Solve independent soft bodies in parallel
+        bool isParallelSoftBody() const { return m_bParallelSoftBody; }
+        void setParallelSoftBody(bool parallel = true);
+
+        //! Number of simulation steps between soft body sparse SDF garbage collections
+        int getSoftBodyGCInterval() const { return m_softBodyGCInterval; }
+        void setSoftBodyGCInterval(int interval) { m_softBodyGCInterval = std::max(interval, 1); }
+
+        //! Interpolate body transforms between fixed steps on render frames
+        bool isInterpolation() const { return m_bInterpolation; }
+        void setInterpolation(bool interpolation = true) { m_bInterpolation = interpolation; }
+
+        //! Collect step counts and per-phase Bullet timings, enabling resets the collected data
+        bool isProfiling() const { return m_bProfiling; }
+        void setProfiling(bool profiling = true);
+
+        //! Profile report: frames, steps, time (ms), stepsPerSec, phases {path: {time (ms), calls}}
+        json getProfileReport() const;
+
         //! Frame max simulation sub step
         int getFrameMaxSubStep() const { return m_frameMaxSubStep; }
         void setFrameMaxSubStep(int nSteps) { m_frameMaxSubStep = nSteps; }
@@ -140,12 +191,42 @@ namespace ige::scene
         //! Check if multiple edit allowed
         virtual bool canMultiEdit() override { return false; }
 
+        //! Body moved by the simulation, sync its transform in postUpdate
+        void onMoved(Rigidbody& object);
+
+        //! Scene object of a collision object: Rigidbody, Softbody or CharacterController
+        static SceneObject* getSceneObject(const btCollisionObject* object);
+
+        //! Contact reports of the last frame, only pairs with a reporting body are included
+        const std::vector<ContactReport>& getContactReports() const { return m_contactReports; }
+
+        //! Binary snapshot of body states (transforms, velocities, activation, soft body nodes, characters), keyed by scene object UUID and body type.
+        //! Baked MeshCollider shapes are saved too, but restoreSnapshot() only restores body states on top of the shapes the colliders built.
+        void saveSnapshot(std::vector<uint8_t>& data);
+        bool restoreSnapshot(const std::vector<uint8_t>& data);
+
+        //! Save/Load snapshot file
+        bool saveSnapshot(const std::string& path);
+        bool loadSnapshot(const std::string& path);
+
+        //! Register baked MeshCollider shapes of a snapshot before loading its scene: matching colliders skip reading figures and building hulls
+        static bool preloadSnapshot(const std::vector<uint8_t>& data);
+        static bool preloadSnapshot(const std::string& path);
 
     protected:
         //! Collision callback
         void setCollisionCallback();
         static bool collisionCallback(btManifoldPoint& cp, const btCollisionObjectWrapper* obj1, int id1, int index1, const btCollisionObjectWrapper* obj2, int id2, int index2);
 
+        //! Accumulate Bullet profile timings of the last stepSimulation call
+        void collectProfile(float stepTime, int numSteps);
+
+        //! Pre-tick callback, keeps body transforms before each step for interpolation
+        static void preTickCallback(btDynamicsWorld* world, btScalar timeStep);
+
+        //! Invoke contact events of the body, filtered by its report flags
+        static void invokeContactEvents(Rigidbody* body, Rigidbody* other, int event);
+
         //! Create/Destroy event
         void onCreated(Rigidbody& object);
         void onDestroyed(Rigidbody& object);
@@ -158,6 +239,10 @@ namespace ige::scene
         void onActivated(PhysicConstraint* constraint);
         void onDeactivated(PhysicConstraint* constraint);
 
+        //! Character controller activated/deactivated event
+        void onActivated(CharacterController& character);
+        void onDeactivated(CharacterController& character);
+
         //! Serialize
         virtual void to_json(json &j) const override;
 
@@ -171,6 +256,7 @@ namespace ige::scene
         std::unique_ptr<btConstraintSolver> m_solver = nullptr;
         std::unique_ptr<btCollisionConfiguration> m_collisionConfiguration = nullptr;
         std::unique_ptr<btGhostPairCallback> m_ghostPairCallback = nullptr;
+        std::unique_ptr<ParallelSoftBodySolver> m_softBodySolver = nullptr;
         std::vector<std::unique_ptr<btRaycastVehicle>> m_vehicles;
 
         //! Last frame time
@@ -182,9 +268,33 @@ namespace ige::scene
         //! Numer of iteration per frame
         int m_numIteration = 1;
 
+        //! Solve independent soft bodies in parallel
+        bool m_bParallelSoftBody = false;
+
+        //! Soft body sparse SDF garbage collection interval, in simulation steps
+        int m_softBodyGCInterval = 16;
+
+        //! Simulation steps since last sparse SDF garbage collection
+        int m_softBodyGCCounter = 0;
+
         //! Frame update ratio (speedup/slower effects)
         float m_frameUpdateRatio = 1.f;
 
+        //! Interpolate body transforms between fixed steps
+        bool m_bInterpolation = false;
+
+        //! Simulation time not stepped yet, same as the world local time
+        float m_accumulator = 0.f;
+
+        //! Profiling state
+        bool m_bProfiling = false;
+        int m_profileFrames = 0;
+        int m_profileSteps = 0;
+        double m_profileTime = 0.0;
+
+        //! Profiled Bullet phases by path: total time (ms) and calls
+        std::map<std::string, std::pair<double, int>> m_profilePhases;
+
         //! Frame max simulation sub step
         int m_frameMaxSubStep = 1;
 
@@ -195,11 +305,26 @@ namespace ige::scene
         btVector3 m_gravity = {0.f, -9.81f, 0.f};
 
         //! Collision event map
-        static std::map< std::pair<Rigidbody*, Rigidbody*>, bool> m_collisionEvents;
+        static std::map< std::pair<Rigidbody*, Rigidbody*>, ContactPairState> m_collisionEvents;
+
+        //! Contact reports of the last frame
+        std::vector<ContactReport> m_contactReports;
+
+        //! Contact events waiting for dispatch: body A, body B, event
+        std::vector<std::tuple<Rigidbody*, Rigidbody*, int>> m_pendingContacts;
 
         //! Physic objects list
         std::vector<std::reference_wrapper<Rigidbody>> m_rigidbodys;
 
+        //! Soft bodies list (no motion state, synced by nodes)
+        std::vector<std::reference_wrapper<Rigidbody>> m_softbodys;
+
+        //! Bodies moved by the last simulation step
+        std::vector<Rigidbody*> m_movedBodies;
+
+        //! Active character controllers
+        std::vector<CharacterController*> m_characters;
+
         //! Debug renderer
         std::unique_ptr<BulletDebugRender> m_debugRenderer = nullptr;
 
@@ -22,6 +22,13 @@ namespace ige::scene
     Event<Rigidbody&> Rigidbody::m_onActivatedEvent;
     Event<Rigidbody&> Rigidbody::m_onDeactivatedEvent;
 
+    //! Motion state changed
+    void RigidbodyMotionState::setWorldTransform(const btTransform& worldTrans)
+    {
+        btDefaultMotionState::setWorldTransform(worldTrans);
+        m_body.onMotionStateChanged();
+    }
+
     //! Constructor
     Rigidbody::Rigidbody(SceneObject& owner)
         : Component(owner)
@@ -291,6 +298,31 @@ namespace ige::scene
             getBody()->forceActivationState(m_activeState);
     }
 
+    //! Contact report flags: only reporting bodies trigger the custom material callback
+    void Rigidbody::setContactReportFlags(int flags)
+    {
+        m_contactReportFlags = flags & CONTACT_REPORT_ALL;
+        if (getActiveReportFlags() != CONTACT_REPORT_NONE)
+            addCollisionFlag(btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK);
+        else
+            removeCollisionFlag(btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK);
+    }
+
+    //! Runtime contact report flags of a script, combined with the other scripts of the object
+    void Rigidbody::setScriptReportFlags(const Component* script, int flags)
+    {
+        flags &= CONTACT_REPORT_ALL;
+        if (flags != CONTACT_REPORT_NONE)
+            m_scriptReportMasks[script] = flags;
+        else
+            m_scriptReportMasks.erase(script);
+
+        m_scriptReportFlags = CONTACT_REPORT_NONE;
+        for (const auto& [key, mask] : m_scriptReportMasks)
+            m_scriptReportFlags |= mask;
+        setContactReportFlags(getContactReportFlags());
+    }
+
     void Rigidbody::setPositionOffset(const Vec3& offset)
     {
         if(m_bIsDirty || m_positionOffset != offset) {
@@ -368,7 +400,7 @@ namespace ige::scene
         
         const auto& transform = getOwner()->getTransform();
         auto offset = transform->getWorldRotationScaleMatrix() * m_positionOffset;
-        m_motion = std::make_unique<btDefaultMotionState>(PhysicHelper::to_btTransform(getOwner()->getTransform()->getRotation(), getOwner()->getTransform()->getPosition() + offset));
+        m_motion = std::make_unique<RigidbodyMotionState>(*this, PhysicHelper::to_btTransform(getOwner()->getTransform()->getRotation(), getOwner()->getTransform()->getPosition() + offset));
         m_body = std::make_unique<btRigidBody>(btRigidBody::btRigidBodyConstructionInfo{0.0f, m_motion.get(),  m_collider.lock()->getShape().get(), btVector3(0.0f, 0.0f, 0.0f)});
         m_body->setUserPointer(this);
 
@@ -396,7 +428,7 @@ namespace ige::scene
         applyInertia();
 
         // Add custom material callback for collision events
-        addCollisionFlag(btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK);
+        setContactReportFlags(getContactReportFlags());
 
         // Add trigger flag
         if (isTrigger())
@@ -405,6 +437,9 @@ namespace ige::scene
         // Update transform
         updateBtTransform();
 
+        // Start interpolation from the created pose
+        savePreviousTransform();
+
 #if EDITOR_MODE
         getOwner()->setAabbDirty();
 #endif
@@ -512,12 +547,37 @@ namespace ige::scene
     //! Update IGE transform
     void Rigidbody::updateIgeTransform()
     {
+        m_bIsMotionDirty = false;
         if (!m_body || isKinematic()) return;
         auto transform = getOwner()->getTransform();
         const auto &result = m_body->getWorldTransform();
-        auto offset = transform->getWorldRotationScaleMatrix() * m_positionOffset;
-        transform->setRotation(PhysicHelper::from_btQuaternion(result.getRotation()));
-        transform->setPosition(PhysicHelper::from_btVector3(result.getOrigin()) - offset);
+        auto rot = PhysicHelper::from_btQuaternion(result.getRotation());
+        const auto& scale = transform->getScale();
+        auto offset = rot * Vec3(m_positionOffset.X() * scale.X(), m_positionOffset.Y() * scale.Y(), m_positionOffset.Z() * scale.Z());
+        transform->setWorldTransform(PhysicHelper::from_btVector3(result.getOrigin()) - offset, rot);
+    }
+
+    //! Update IGE transform, interpolated between the previous and the current step
+    void Rigidbody::interpolateIgeTransform(float alpha)
+    {
+        m_bIsMotionDirty = false;
+        if (!m_body || isKinematic()) return;
+        auto transform = getOwner()->getTransform();
+        const auto &current = m_body->getWorldTransform();
+        auto position = m_previousTransform.getOrigin().lerp(current.getOrigin(), alpha);
+        auto rot = PhysicHelper::from_btQuaternion(m_previousTransform.getRotation().slerp(current.getRotation(), alpha));
+        const auto& scale = transform->getScale();
+        auto offset = rot * Vec3(m_positionOffset.X() * scale.X(), m_positionOffset.Y() * scale.Y(), m_positionOffset.Z() * scale.Z());
+        transform->setWorldTransform(PhysicHelper::from_btVector3(position) - offset, rot);
+    }
+
+    //! Motion state changed: queue transform sync once per step
+    void Rigidbody::onMotionStateChanged()
+    {
+        if (m_bIsMotionDirty) return;
+        m_bIsMotionDirty = true;
+        if (auto manager = getManager())
+            manager->onMoved(*this);
     }
 
     //! Get AABB
@@ -538,6 +598,7 @@ namespace ige::scene
         auto offset = transform->getWorldRotationScaleMatrix() * m_positionOffset;
         worldTrans.setOrigin(pos + PhysicHelper::to_btVector3(offset));
         m_body->setWorldTransform(worldTrans);
+        m_previousTransform = worldTrans;
     }
 
     void Rigidbody::moveRotation(const btQuaternion& quat) {
@@ -545,6 +606,7 @@ namespace ige::scene
         auto worldTrans = m_body->getWorldTransform();
         worldTrans.setRotation(quat);
         m_body->setWorldTransform(worldTrans);
+        m_previousTransform = worldTrans;
     }
 
     //! Serialize
@@ -568,6 +630,7 @@ namespace ige::scene
         j["angularSleepingThreshold"] = getAngularSleepingThreshold();
         j["activeState"] = getActivationState();
         j["offset"] = getPositionOffset();
+        j["report"] = getContactReportFlags();
 
         auto jConstraints = json::array();
         for (const auto &constraint : m_constraints)
@@ -597,6 +660,7 @@ namespace ige::scene
         setAngularSleepingThreshold(j.value("angularSleepingThreshold", 0.f));
         setActivationState(j.value("activeState", 1));
         setPositionOffset(j.value("offset", Vec3(0.f, 0.f, 0.f)));
+        setContactReportFlags(j.value("report", (int)CONTACT_REPORT_NONE));
     }
 
     void Rigidbody::onSerializeFinished() {
@@ -669,6 +733,8 @@ namespace ige::scene
             setActivationState(val);
         else if (key.compare("offset") == 0)
             setPositionOffset(val);
+        else if (key.compare("report") == 0)
+            setContactReportFlags(val);
         else
             Component::setProperty(key, val);
     }
@@ -11,10 +11,37 @@ using namespace pyxie;
 #include <btBulletDynamicsCommon.h>
 #include <BulletSoftBody/btSoftBody.h>
 
+#include <unordered_map>
+
 namespace ige::scene
 {
     class PhysicConstraint;
     class PhysicManager;
+    class Rigidbody;
+
+    //! Motion state: notify the owner body when Bullet moves it
+    class RigidbodyMotionState : public btDefaultMotionState
+    {
+    public:
+        RigidbodyMotionState(Rigidbody& body, const btTransform& startTrans)
+            : btDefaultMotionState(startTrans), m_body(body) {}
+
+        //! Called by Bullet only for active (non-sleeping) bodies
+        virtual void setWorldTransform(const btTransform& worldTrans) override;
+
+    protected:
+        Rigidbody& m_body;
+    };
+
+    //! Contact report flags: which contact phases a body reports
+    enum ContactReportFlag
+    {
+        CONTACT_REPORT_NONE = 0,
+        CONTACT_REPORT_ENTER = 0x01,
+        CONTACT_REPORT_STAY = 0x02,
+        CONTACT_REPORT_EXIT = 0x04,
+        CONTACT_REPORT_ALL = CONTACT_REPORT_ENTER | CONTACT_REPORT_STAY | CONTACT_REPORT_EXIT
+    };
 
     //! Rigidbody
     class Rigidbody : public Component
@@ -138,6 +165,17 @@ namespace ige::scene
         virtual int getCollisionFilterMask() const { return m_collisionFilterMask; }
         virtual void setCollisionFilterMask(int mask);
 
+        //! Contact report flags, bodies without flags are skipped by the collision callback
+        int getContactReportFlags() const { return m_contactReportFlags; }
+        virtual void setContactReportFlags(int flags);
+
+        //! Runtime contact report flags requested by scripts, not serialized. Each script sets its own flags, NONE removes them.
+        int getScriptReportFlags() const { return m_scriptReportFlags; }
+        void setScriptReportFlags(const Component* script, int flags);
+
+        //! Contact report flags used by the collision callback
+        int getActiveReportFlags() const { return m_contactReportFlags | m_scriptReportFlags; }
+
         //! Position offset
         const Vec3& getPositionOffset() const { return m_positionOffset; }
         void setPositionOffset(const Vec3& offset);
@@ -204,6 +242,15 @@ namespace ige::scene
         //! Update IGE transform
         virtual void updateIgeTransform();
 
+        //! Update IGE transform, interpolated between the previous and the current step by alpha
+        void interpolateIgeTransform(float alpha);
+
+        //! Keep the transform before a simulation step, used by interpolation
+        void savePreviousTransform() { if (m_body) m_previousTransform = m_body->getWorldTransform(); }
+
+        //! Motion state changed: body was moved by the simulation
+        virtual void onMotionStateChanged();
+
         //! Get onCreatedEvent
         static Event<Rigidbody&>& getOnCreatedEvent() { return m_onCreatedEvent; }
         static Event<Rigidbody&>& getOnDestroyedEvent() { return m_onDestroyedEvent; }
@@ -330,9 +377,22 @@ namespace ige::scene
         //! Cache dirty state
         bool m_bIsDirty = false;
 
+        //! Moved by the simulation, waiting to sync back to transform
+        bool m_bIsMotionDirty = false;
+
+        //! Body transform before the last simulation step
+        btTransform m_previousTransform = btTransform::getIdentity();
+
         //! Cache activeState
         int m_activeState = 1;
 
+        //! Contact report flags
+        int m_contactReportFlags = CONTACT_REPORT_NONE;
+
+        //! Runtime contact report flags by script, and their combination
+        std::unordered_map<const Component*, int> m_scriptReportMasks;
+        int m_scriptReportFlags = CONTACT_REPORT_NONE;
+
         //! Enable gravity
         bool m_bEnableGravity = true;
 
@@ -21,6 +21,12 @@ namespace fs = ghc::filesystem;
 
 namespace ige::scene
 {
+    //! Vertex welding distance
+    constexpr float SOFTBODY_WELD_EPSILON = 0.0001f;
+
+    //! Initialize static members
+    std::unordered_map<std::string, std::weak_ptr<SoftbodyMesh>> Softbody::m_meshCache;
+
     //! Constructor
     Softbody::Softbody(SceneObject& owner)
         : Rigidbody(owner)
@@ -31,9 +37,7 @@ namespace ige::scene
     //! Destructor
     Softbody::~Softbody()
     {
-        if (m_indicesMap != nullptr)
-            delete[] m_indicesMap;
-        m_indicesMap = nullptr;
+        m_softMesh = nullptr;
     }
 
     //! Get AABB
@@ -257,6 +261,7 @@ namespace ige::scene
     void Softbody::createBody()
     {
         destroyBody();
+        m_softMesh = nullptr;
         auto world = getManager()->getDeformableWorld();
         Figure *figure = nullptr;
         std::vector<Vec3> positions;
@@ -270,50 +275,90 @@ namespace ige::scene
             figure->WaitInitialize();
             if (figure->NumMeshes() > 0 && m_meshIndex >= 0 && m_meshIndex < figure->NumMeshes())
             {
-                int offset = 0;
-                int size = 100000000;
-                int space = Space::WorldSpace;
-
                 auto mesh = figure->GetMesh(m_meshIndex);
-                auto attIdx = -1;
-                for (uint16_t i = 0; i < mesh->numVertexAttributes; ++i)
+
+                // Reuse welded topology of the same figure mesh
+                auto key = std::string(figure->ResourceName());
+                if (!key.empty())
+                    key += ":" + std::to_string(m_meshIndex);
+                auto found = key.empty() ? m_meshCache.end() : m_meshCache.find(key);
+                if (found != m_meshCache.end())
+                    m_softMesh = found->second.lock();
+                if (m_softMesh && m_softMesh->indicesMap.size() != mesh->numVerticies)
+                    m_softMesh = nullptr;
+
+                if (m_softMesh == nullptr)
                 {
-                    if (mesh->vertexAttributes[i].id == AttributeID::ATTRIBUTE_ID_POSITION)
+                    int offset = 0;
+                    int size = 100000000;
+                    int space = Space::LocalSpace;
+
+                    auto attIdx = -1;
+                    for (uint16_t i = 0; i < mesh->numVertexAttributes; ++i)
                     {
-                        attIdx = i;
-                        break;
+                        if (mesh->vertexAttributes[i].id == AttributeID::ATTRIBUTE_ID_POSITION)
+                        {
+                            attIdx = i;
+                            break;
+                        }
                     }
-                }
 
-                if (attIdx != -1)
-                {
-                    if (size + offset > mesh->numVerticies)
-                        size = mesh->numVerticies - offset;
+                    if (attIdx != -1)
+                    {
+                        if (size + offset > mesh->numVerticies)
+                            size = mesh->numVerticies - offset;
+
+                        if (size > 0)
+                        {
+                            float *palettebuffer = nullptr;
+                            float *inbindSkinningMatrices = nullptr;
+                            figure->AllocTransformBuffer(space, palettebuffer, inbindSkinningMatrices);
+                            figure->ReadPositions(m_meshIndex, offset, size, space, palettebuffer, inbindSkinningMatrices, &positions);
+                            if (inbindSkinningMatrices)
+                                PYXIE_FREE_ALIGNED(inbindSkinningMatrices);
+                            if (palettebuffer)
+                                PYXIE_FREE_ALIGNED(palettebuffer);
+                        }
+                    }
 
-                    if (size > 0)
+                    if (!positions.empty())
                     {
-                        float *palettebuffer = nullptr;
-                        float *inbindSkinningMatrices = nullptr;
-                        figure->AllocTransformBuffer(space, palettebuffer, inbindSkinningMatrices);
-                        figure->ReadPositions(m_meshIndex, offset, size, space, palettebuffer, inbindSkinningMatrices, &positions);
-                        if (inbindSkinningMatrices)
-                            PYXIE_FREE_ALIGNED(inbindSkinningMatrices);
-                        if (palettebuffer)
-                            PYXIE_FREE_ALIGNED(palettebuffer);
+                        std::vector<int> indices(mesh->numIndices);
+                        for (uint32_t i = 0; i < mesh->numIndices; ++i)
+                            indices[i] = (int)mesh->indices[i];
+
+                        m_softMesh = optimizeMesh(positions, indices, SOFTBODY_WELD_EPSILON);
+                        if (!key.empty())
+                        {
+                            // Drop entries of meshes no longer used
+                            for (auto itr = m_meshCache.begin(); itr != m_meshCache.end();)
+                                itr = itr->second.expired() ? m_meshCache.erase(itr) : std::next(itr);
+                            m_meshCache[key] = m_softMesh;
+                        }
                     }
+                    positions.clear();
                 }
 
-                auto indices = new int[mesh->numIndices];
-                for (uint32_t i = 0; i < mesh->numIndices; ++i)
-                    indices[i] = (int)mesh->indices[i];
-
-                float *optPoss;
-                optimizeMesh(positions, indices, mesh->numIndices, optPoss);
-                m_body = std::unique_ptr<btSoftBody>(btSoftBodyHelpers::CreateFromTriMesh(world->getWorldInfo(), optPoss, indices, mesh->numIndices / 3));
-
-                positions.clear();
-                delete[] indices;
-                delete[] optPoss;
+                if (m_softMesh && !m_softMesh->indices.empty())
+                {
+                    // Place the shared local space nodes at this instance's transform
+                    const auto& mat = getOwner()->getTransform()->getWorldMatrix();
+                    btMatrix3x3 basis(mat[0][0], mat[1][0], mat[2][0],
+                                      mat[0][1], mat[1][1], mat[2][1],
+                                      mat[0][2], mat[1][2], mat[2][2]);
+                    btTransform trans(basis, btVector3(mat[3][0], mat[3][1], mat[3][2]));
+
+                    const auto& localPositions = m_softMesh->positions;
+                    std::vector<btScalar> worldPositions(localPositions.size());
+                    for (size_t i = 0; i + 2 < localPositions.size(); i += 3)
+                    {
+                        const auto pos = trans(btVector3(localPositions[i], localPositions[i + 1], localPositions[i + 2]));
+                        worldPositions[i + 0] = pos.x();
+                        worldPositions[i + 1] = pos.y();
+                        worldPositions[i + 2] = pos.z();
+                    }
+                    m_body = std::unique_ptr<btSoftBody>(btSoftBodyHelpers::CreateFromTriMesh(world->getWorldInfo(), worldPositions.data(), m_softMesh->indices.data(), (int)m_softMesh->indices.size() / 3));
+                }
             }
         }
 
@@ -372,11 +417,14 @@ namespace ige::scene
         setCCD(m_bIsCCD);
 
         // Add custom material callback for collision events
-        addCollisionFlag(btCollisionObject::CF_CUSTOM_MATERIAL_CALLBACK);
+        setContactReportFlags(getContactReportFlags());
 
         // Update transform
         updateBtTransform();
 
+        // Start interpolation from the created pose
+        savePreviousTransform();
+
         m_bIsDirty = false;
 
         // Activate
@@ -432,176 +480,179 @@ namespace ige::scene
         return getSoftBody()->m_nodes[idx].m_n;
     }
 
+    //! Write node data into an interleaved vertex attribute, one tight loop per format
+    template <typename T, typename Converter>
+    static void writeVertexAttribute(const float* nodeData, const int* indicesMap, int numVerts, uint8_t* dst, int stride, int numComps, Converter convert)
+    {
+        for (int i = 0; i < numVerts; ++i)
+        {
+            const float* src = nodeData + indicesMap[i] * 3;
+            auto out = (T*)(dst + i * stride);
+            for (int j = 0; j < numComps; ++j)
+                out[j] = convert(src[j]);
+        }
+    }
+
+    //! Convert node data to the attribute format of the mesh
+    template <typename MeshType>
+    static bool writeNodeAttribute(const MeshType* mesh, int attIdx, const float* nodeData, const int* indicesMap)
+    {
+        if (attIdx == -1)
+            return false;
+
+        const auto& attr = mesh->vertexAttributes[attIdx];
+        auto dst = ((uint8_t*)mesh->vertices) + attr.offset;
+        int stride = mesh->vertexFormatSize;
+        int numComps = std::min((int)attr.size, 3);
+
+        switch (attr.type)
+        {
+        case GL_FLOAT:
+            writeVertexAttribute<float>(nodeData, indicesMap, mesh->numVerticies, dst, stride, numComps, [](float v) { return v; });
+            return true;
+        case GL_SHORT:
+            writeVertexAttribute<int16_t>(nodeData, indicesMap, mesh->numVerticies, dst, stride, numComps, [](float v) { return F32toS16(v); });
+            return true;
+        case GL_HALF_FLOAT:
+            writeVertexAttribute<uint16_t>(nodeData, indicesMap, mesh->numVerticies, dst, stride, numComps, [](float v) { return F32toF16(v); });
+            return true;
+        case GL_UNSIGNED_BYTE:
+            writeVertexAttribute<uint8_t>(nodeData, indicesMap, mesh->numVerticies, dst, stride, numComps, [](float v) { return F32toU8(v); });
+            return true;
+        }
+        return false;
+    }
+
     //! Update IGE transform
     void Softbody::updateIgeTransform()
     {
-        // Update transform
-        auto transform = getOwner()->getTransform();
-        // Update position and normal
         auto figureComp = getOwner()->getComponent<FigureComponent>();
-        if (!figureComp || !figureComp->getFigure())
+        if (!figureComp || !figureComp->getFigure() || !getSoftBody() || !m_softMesh)
             return;
 
-        int offset = 0;
-
         auto figure = figureComp->getFigure();
         auto mesh = figure->GetMesh(m_meshIndex);
-        auto attIdx = -1;
+        if (mesh == nullptr || m_softMesh->indicesMap.size() != mesh->numVerticies)
+            return;
+
+        auto posIdx = -1;
+        auto normIdx = -1;
         for (uint16_t i = 0; i < mesh->numVertexAttributes; ++i)
         {
             if (mesh->vertexAttributes[i].id == AttributeID::ATTRIBUTE_ID_POSITION)
-            {
-                attIdx = i;
-                break;
-            }
+                posIdx = i;
+            else if (mesh->vertexAttributes[i].id == AttributeID::ATTRIBUTE_ID_NORMAL)
+                normIdx = i;
         }
+        if (posIdx == -1 && normIdx == -1)
+            return;
 
-        if (attIdx != -1)
-        {
-            int elemSize = 0;
-            switch (mesh->vertexAttributes[attIdx].type)
-            {
-            case GL_FLOAT:
-                elemSize = 4;
-                break;
-            case GL_SHORT:
-                elemSize = 2;
-                break;
-            case GL_HALF_FLOAT:
-                elemSize = 2;
-                break;
-            case GL_UNSIGNED_BYTE:
-                elemSize = 1;
-                break;
-            }
-
-            const auto &nodes = getSoftBody()->m_nodes;
-            for (int i = 0; i < mesh->numVerticies; ++i)
-            {
-                int idx = m_indicesMap[i];
-                auto *buffer = (uint8_t *)PYXIE_MALLOC(3 * elemSize);
-                MemoryCleaner cleaner(buffer);
-                auto pos = transform->getWorldMatrix().Inverse() * (PhysicHelper::from_btVector3(nodes[idx].m_x));
-                for (int j = 0; j < 3; ++j)
-                {
-                    switch (mesh->vertexAttributes[attIdx].type)
-                    {
-                    case GL_FLOAT:
-                        ((float *)buffer)[j] = pos[j];
-                        break;
-                    case GL_SHORT:
-                        ((int16_t *)buffer)[j] = F32toS16(pos[j]);
-                        break;
-                    case GL_HALF_FLOAT:
-                        ((uint16_t *)buffer)[j] = F32toF16(pos[j]);
-                        break;
-                    case GL_UNSIGNED_BYTE:
-                        ((uint8_t *)buffer)[j] = F32toU8(pos[j]);
-                        break;
-                    }
-                }
-                uint8_t *location = ((uint8_t *)mesh->vertices) + (i + offset) * mesh->vertexFormatSize + mesh->vertexAttributes[attIdx].offset;
-                memcpy(location, buffer, elemSize * mesh->vertexAttributes[attIdx].size);
-            }
+        // World to local transform, computed once for all nodes
+        auto invMat = getOwner()->getTransform()->getWorldMatrix().Inverse();
+        btMatrix3x3 basis(invMat[0][0], invMat[1][0], invMat[2][0],
+                          invMat[0][1], invMat[1][1], invMat[2][1],
+                          invMat[0][2], invMat[1][2], invMat[2][2]);
+        btTransform invTrans(basis, btVector3(invMat[3][0], invMat[3][1], invMat[3][2]));
+
+        // Convert nodes into staging buffer: positions then normals, 3 floats per node
+        const auto& nodes = getSoftBody()->m_nodes;
+        const int numNodes = nodes.size();
+        m_stagingBuffer.resize(numNodes * 6);
+        auto positions = m_stagingBuffer.data();
+        auto normals = positions + numNodes * 3;
+        for (int i = 0; i < numNodes; ++i)
+        {
+            const auto pos = invTrans(nodes[i].m_x);
+            const auto& norm = nodes[i].m_n;
+            positions[i * 3 + 0] = pos.x();
+            positions[i * 3 + 1] = pos.y();
+            positions[i * 3 + 2] = pos.z();
+            normals[i * 3 + 0] = norm.x();
+            normals[i * 3 + 1] = norm.y();
+            normals[i * 3 + 2] = norm.z();
+        }
+
+        // Write to vertex buffer, then upload once
+        const auto indicesMap = m_softMesh->indicesMap.data();
+        bool updated = writeNodeAttribute(mesh, posIdx, positions, indicesMap);
+        updated |= writeNodeAttribute(mesh, normIdx, normals, indicesMap);
+        if (updated)
             figure->ResetMeshBuffer(m_meshIndex, true, false, true);
-        }
-
-        attIdx = -1;
-        for (uint16_t i = 0; i < mesh->numVertexAttributes; ++i)
-        {
-            if (mesh->vertexAttributes[i].id == AttributeID::ATTRIBUTE_ID_NORMAL)
-            {
-                attIdx = i;
-                break;
-            }
-        }
-        if (attIdx != -1)
-        {
-            int elemSize = 0;
-            switch (mesh->vertexAttributes[attIdx].type)
-            {
-            case GL_FLOAT:
-                elemSize = 4;
-                break;
-            case GL_SHORT:
-                elemSize = 2;
-                break;
-            case GL_HALF_FLOAT:
-                elemSize = 2;
-                break;
-            case GL_UNSIGNED_BYTE:
-                elemSize = 1;
-                break;
-            }
-
-            const auto &nodes = getSoftBody()->m_nodes;
-            for (int i = 0; i < mesh->numVerticies; ++i)
-            {
-                int idx = m_indicesMap[i];
-                auto *buffer = (uint8_t *)PYXIE_MALLOC(3 * elemSize);
-                MemoryCleaner cleaner(buffer);
+    }
 
-                for (int j = 0; j < 3; ++j)
-                {
-                    switch (mesh->vertexAttributes[attIdx].type)
+    //! Optimize mesh: weld vertices closer than epsilon using a spatial hash
+    std::shared_ptr<SoftbodyMesh> Softbody::optimizeMesh(const std::vector<Vec3>& positions, const std::vector<int>& indices, float epsilon)
+    {
+        auto result = std::make_shared<SoftbodyMesh>();
+        const int numVerts = (int)positions.size();
+        result->indicesMap.assign(numVerts, -1);
+        result->indices.resize(indices.size());
+        result->positions.reserve(numVerts * 3);
+
+        // Hash grid with cell size of epsilon: cell -> first welded node, nodes of a cell chained by 'next'
+        const float invCellSize = 1.f / epsilon;
+        const float epsilonSqr = epsilon * epsilon;
+        std::unordered_map<uint64_t, int> cells;
+        cells.reserve(numVerts);
+        std::vector<int> next;
+        next.reserve(numVerts);
+
+        auto cellCoord = [invCellSize](float v) { return (int64_t)std::floor(v * invCellSize); };
+        auto cellKey = [](int64_t x, int64_t y, int64_t z) {
+            return ((uint64_t)x * 73856093ull) ^ ((uint64_t)y * 19349663ull) ^ ((uint64_t)z * 83492791ull);
+        };
+
+        // Find welded node within epsilon, searching neighbour cells
+        auto findNode = [&](const Vec3& v) {
+            auto cx = cellCoord(v[0]), cy = cellCoord(v[1]), cz = cellCoord(v[2]);
+            for (int64_t z = cz - 1; z <= cz + 1; ++z)
+                for (int64_t y = cy - 1; y <= cy + 1; ++y)
+                    for (int64_t x = cx - 1; x <= cx + 1; ++x)
                     {
-                    case GL_FLOAT:
-                        ((float *)buffer)[j] = nodes[idx].m_n[j];
-                        break;
-                    case GL_SHORT:
-                        ((int16_t *)buffer)[j] = F32toS16(nodes[idx].m_n[j]);
-                        break;
-                    case GL_HALF_FLOAT:
-                        ((uint16_t *)buffer)[j] = F32toF16(nodes[idx].m_n[j]);
-                        break;
-                    case GL_UNSIGNED_BYTE:
-                        ((uint8_t *)buffer)[j] = F32toU8(nodes[idx].m_n[j]);
-                        break;
+                        auto cell = cells.find(cellKey(x, y, z));
+                        if (cell == cells.end())
+                            continue;
+                        for (int node = cell->second; node != -1; node = next[node])
+                        {
+                            const float* p = &result->positions[node * 3];
+                            float dx = p[0] - v[0], dy = p[1] - v[1], dz = p[2] - v[2];
+                            if (dx * dx + dy * dy + dz * dz <= epsilonSqr)
+                                return node;
+                        }
                     }
-                }
-                uint8_t *location = ((uint8_t *)mesh->vertices) + (i + offset) * mesh->vertexFormatSize + mesh->vertexAttributes[attIdx].offset;
-                memcpy(location, buffer, elemSize * mesh->vertexAttributes[attIdx].size);
-            }
-            figure->ResetMeshBuffer(m_meshIndex, true, false, true);
-        }
-    }
-
-    //! Optimize mesh
-    void Softbody::optimizeMesh(const std::vector<Vec3> &orgPoss, int *indices, int numIndeces, float *&optPoss)
-    {
-        if (m_indicesMap != nullptr)
-            delete[] m_indicesMap;
-        m_indicesMap = new int[orgPoss.size()];
+            return -1;
+        };
 
-        std::map<Vec3, int> vecList;
-        int numOptVertex = 0;
-        for (int i = 0; i < numIndeces; i++)
+        // Weld referenced vertices, in index order
+        for (size_t i = 0; i < indices.size(); ++i)
         {
             int idx = indices[i];
-            const Vec3 &v = orgPoss[idx];
-            if (vecList.count(v) == 0)
+            auto& mapped = result->indicesMap[idx];
+            if (mapped == -1)
             {
-                vecList[v] = numOptVertex;
-                numOptVertex++;
+                const auto& v = positions[idx];
+                mapped = findNode(v);
+                if (mapped == -1)
+                {
+                    mapped = (int)next.size();
+                    auto& head = cells.emplace(cellKey(cellCoord(v[0]), cellCoord(v[1]), cellCoord(v[2])), -1).first->second;
+                    next.push_back(head);
+                    head = mapped;
+                    result->positions.push_back(v[0]);
+                    result->positions.push_back(v[1]);
+                    result->positions.push_back(v[2]);
+                }
             }
-            m_indicesMap[idx] = indices[i] = vecList[v];
+            result->indices[i] = mapped;
         }
-        std::map<uint32_t, Vec3> vecListRV;
-        for (const auto &it : vecList)
-            vecListRV[it.second] = it.first;
 
-        optPoss = new float[vecListRV.size() * 3];
-        int numf = 0;
-        for (const auto &it : vecListRV)
+        // Unreferenced vertices follow the closest welded node, if any
+        for (int i = 0; i < numVerts; ++i)
         {
-            for (int i = 0; i < 3; i++)
-            {
-                optPoss[numf] = it.second[i];
-                numf++;
-            }
+            if (result->indicesMap[i] == -1)
+                result->indicesMap[i] = std::max(findNode(positions[i]), 0);
         }
-        vecList.clear();
-        vecListRV.clear();
+        return result;
     }
 
     //! Serialize
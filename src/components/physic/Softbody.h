@@ -1,5 +1,10 @@
 #pragma once
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <btBulletCollisionCommon.h>
 #include <btBulletDynamicsCommon.h>
 #include <BulletSoftBody/btSoftBody.h>
@@ -13,6 +18,19 @@ using namespace pyxie;
 
 namespace ige::scene
 {
+    //! Welded soft body topology, shared by soft bodies created from the same mesh
+    struct SoftbodyMesh
+    {
+        //! Welded node positions in local space, 3 floats per node
+        std::vector<float> positions;
+
+        //! Triangle indices of welded nodes
+        std::vector<int> indices;
+
+        //! Mesh vertex index to welded node index
+        std::vector<int> indicesMap;
+    };
+
     //! Softbody
     class Softbody : public Rigidbody
     {
@@ -188,6 +206,9 @@ namespace ige::scene
         //! Get node normal
         virtual btVector3 getNodeNormal(int idx);
 
+        //! Clear cached welded meshes, called when the physic world is cleared
+        static void clearMeshCache() { m_meshCache.clear(); }
+
     protected:
         //! Serialize
         virtual void to_json(json &j) const override;
@@ -199,8 +220,8 @@ namespace ige::scene
         //! Set local scale
         virtual void setScale(const Vec3& scale);
 
-        //! Optimize mesh
-        void optimizeMesh(const std::vector<Vec3>&, int* indices, int numIndeces, float*& optPoss);
+        //! Optimize mesh: weld vertices closer than epsilon using a spatial hash
+        static std::shared_ptr<SoftbodyMesh> optimizeMesh(const std::vector<Vec3>& positions, const std::vector<int>& indices, float epsilon);
 
     protected:
         //! Mesh index
@@ -263,7 +284,13 @@ namespace ige::scene
         //! Wind Velocity
         btVector3 m_windVelocity = {0.f, 0.f, 0.f};
 
-        //! Cache indices map
-        int* m_indicesMap = nullptr;
+        //! Welded mesh
+        std::shared_ptr<SoftbodyMesh> m_softMesh = nullptr;
+
+        //! Welded local space meshes, keyed by figure path and mesh index, released with the last user
+        static std::unordered_map<std::string, std::weak_ptr<SoftbodyMesh>> m_meshCache;
+
+        //! Staging buffer of local node positions and normals, reused between frames
+        std::vector<float> m_stagingBuffer;
 };
 } // namespace ige::scene
@@ -42,7 +42,7 @@ namespace ige::scene
             
 
             for (auto& collider : colliders) {
-                if (collider->getType() != Component::Type::CompoundCollider && collider->getType() != Component::Type::MeshCollider && !collider->getOwner()->getComponent<Rigidbody>()) {
+                if (collider->getType() != Component::Type::CompoundCollider && collider->getType() != Component::Type::MeshCollider && collider->getType() != Component::Type::HeightfieldCollider && !collider->getOwner()->getComponent<Rigidbody>()) {
                     collider->setCompoundCollider(compoundCollider);
 
                     auto localMatrix = transform->getWorldMatrix().Inverse() * collider->getOwner()->getTransform()->getWorldMatrix();
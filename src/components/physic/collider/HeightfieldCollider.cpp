@@ -0,0 +1,342 @@
+#include <btBulletCollisionCommon.h>
+#include <BulletCollision/CollisionShapes/btHeightfieldTerrainShape.h>
+
+#include "components/physic/collider/HeightfieldCollider.h"
+#include "components/physic/Rigidbody.h"
+#include "components/FigureComponent.h"
+#include "scene/SceneObject.h"
+#include "utils/PhysicHelper.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include "utils/filesystem.h"
+namespace fs = ghc::filesystem;
+
+namespace ige::scene
+{
+    //! Max absolute quantized height
+    constexpr float HEIGHTFIELD_QUANTIZE_MAX = 32767.f;
+
+    //! Count distinct values within tolerance
+    static int countDistinct(std::vector<float>& values, float tolerance)
+    {
+        if (values.empty())
+            return 0;
+        std::sort(values.begin(), values.end());
+        int count = 1;
+        float last = values[0];
+        for (const auto& value : values)
+        {
+            if (value - last > tolerance)
+            {
+                ++count;
+                last = value;
+            }
+        }
+        return count;
+    }
+
+    //! Constructor
+    HeightfieldCollider::HeightfieldCollider(SceneObject& owner)
+        : Collider(owner)
+    {
+    }
+
+    //! Destructor
+    HeightfieldCollider::~HeightfieldCollider()
+    {
+        destroyShape();
+    }
+
+    //! Height image path
+    void HeightfieldCollider::setPath(const std::string& path)
+    {
+        auto relPath = path;
+        if (!relPath.empty())
+        {
+            auto fsPath = fs::path(path);
+            relPath = fsPath.is_absolute() ? fs::relative(fsPath).string() : fsPath.string();
+            if (relPath.size() == 0) relPath = fsPath.string();
+            std::replace(relPath.begin(), relPath.end(), '\\', '/');
+        }
+
+        if (m_path != relPath)
+        {
+            m_path = relPath;
+            recreateShape();
+        }
+    }
+
+    //! Mesh index
+    void HeightfieldCollider::setMeshIndex(int idx)
+    {
+        if (m_meshIndex != idx)
+        {
+            m_meshIndex = idx;
+            if (m_path.empty()) recreateShape();
+        }
+    }
+
+    //! Terrain size
+    void HeightfieldCollider::setTerrainSize(const Vec2& size)
+    {
+        m_terrainSize = size;
+        if (!m_path.empty()) recreateShape();
+    }
+
+    //! Height range
+    void HeightfieldCollider::setHeightRange(const Vec2& range)
+    {
+        m_heightRange = range;
+        if (!m_path.empty()) recreateShape();
+    }
+
+    //! Sample position in local space
+    Vec3 HeightfieldCollider::getLocalPoint(int x, int z) const
+    {
+        auto height = m_heightCenter + m_heights[z * m_width + x] * m_heightScale;
+        return Vec3((m_origin.X() + x * m_spacing.X()) * m_scale.X(), height * m_scale.Y(), (m_origin.Y() + z * m_spacing.Y()) * m_scale.Z());
+    }
+
+    //! Bounding box in local space
+    AABBox HeightfieldCollider::getLocalBoundingBox() const
+    {
+        auto halfHeight = HEIGHTFIELD_QUANTIZE_MAX * m_heightScale;
+        auto p0 = Vec3(m_origin.X() * m_scale.X(), (m_heightCenter - halfHeight) * m_scale.Y(), m_origin.Y() * m_scale.Z());
+        auto p1 = Vec3((m_origin.X() + (m_width - 1) * m_spacing.X()) * m_scale.X(), (m_heightCenter + halfHeight) * m_scale.Y(), (m_origin.Y() + (m_length - 1) * m_spacing.Y()) * m_scale.Z());
+        return AABBox(Vec3(std::min(p0.X(), p1.X()), std::min(p0.Y(), p1.Y()), std::min(p0.Z(), p1.Z())),
+                      Vec3(std::max(p0.X(), p1.X()), std::max(p0.Y(), p1.Y()), std::max(p0.Z(), p1.Z())));
+    }
+
+    //! Sample heights from the figure grid mesh
+    bool HeightfieldCollider::loadFromFigure(std::vector<float>& heights)
+    {
+        auto figureComp = getOwner()->getComponent<FigureComponent>();
+        auto figure = figureComp ? figureComp->getFigure() : nullptr;
+        if (figure == nullptr)
+            return false;
+
+        figure->WaitInitialize();
+        getOwner()->onUpdate(0.f); // force update transform
+
+        if (m_meshIndex < 0 || m_meshIndex >= figure->NumMeshes())
+            return false;
+
+        auto mesh = figure->GetMesh(m_meshIndex);
+        if (mesh->numVerticies <= 0)
+            return false;
+
+        std::vector<Vec3> positions;
+        int space = Space::LocalSpace;
+        float* palettebuffer = nullptr;
+        float* inbindSkinningMatrices = nullptr;
+        figure->AllocTransformBuffer(space, palettebuffer, inbindSkinningMatrices);
+        figure->ReadPositions(m_meshIndex, 0, mesh->numVerticies, space, palettebuffer, inbindSkinningMatrices, &positions);
+        if (inbindSkinningMatrices)
+            PYXIE_FREE_ALIGNED(inbindSkinningMatrices);
+        if (palettebuffer)
+            PYXIE_FREE_ALIGNED(palettebuffer);
+        if (positions.empty())
+            return false;
+
+        // Grid resolution from the distinct X and Z coordinates
+        Vec3 minPos = positions[0], maxPos = positions[0];
+        std::vector<float> xs, zs;
+        xs.reserve(positions.size());
+        zs.reserve(positions.size());
+        for (const auto& pos : positions)
+        {
+            minPos = Vec3(std::min(minPos.X(), pos.X()), std::min(minPos.Y(), pos.Y()), std::min(minPos.Z(), pos.Z()));
+            maxPos = Vec3(std::max(maxPos.X(), pos.X()), std::max(maxPos.Y(), pos.Y()), std::max(maxPos.Z(), pos.Z()));
+            xs.push_back(pos.X());
+            zs.push_back(pos.Z());
+        }
+        auto tolerance = std::max(maxPos.X() - minPos.X(), maxPos.Z() - minPos.Z()) * 0.0001f;
+        m_width = countDistinct(xs, tolerance);
+        m_length = countDistinct(zs, tolerance);
+        if (m_width < 2 || m_length < 2)
+            return false;
+
+        m_origin = Vec2(minPos.X(), minPos.Z());
+        m_spacing = Vec2((maxPos.X() - minPos.X()) / (m_width - 1), (maxPos.Z() - minPos.Z()) / (m_length - 1));
+
+        // Splat vertices to the grid, keep the highest one per sample
+        heights.assign(m_width * m_length, -INFINITY);
+        for (const auto& pos : positions)
+        {
+            auto x = std::clamp((int)std::round((pos.X() - m_origin.X()) / m_spacing.X()), 0, m_width - 1);
+            auto z = std::clamp((int)std::round((pos.Z() - m_origin.Y()) / m_spacing.Y()), 0, m_length - 1);
+            auto& height = heights[z * m_width + x];
+            height = std::max(height, pos.Y());
+        }
+
+        // Fill holes from the nearest sample in the row
+        for (int z = 0; z < m_length; ++z)
+        {
+            auto* row = &heights[z * m_width];
+            float last = -INFINITY;
+            for (int x = 0; x < m_width; ++x)
+            {
+                if (row[x] == -INFINITY) row[x] = last;
+                else last = row[x];
+            }
+            last = -INFINITY;
+            for (int x = m_width - 1; x >= 0; --x)
+            {
+                if (row[x] == -INFINITY) row[x] = last;
+                else last = row[x];
+            }
+            for (int x = 0; x < m_width; ++x)
+                if (row[x] == -INFINITY) row[x] = minPos.Y();
+        }
+        return true;
+    }
+
+    //! Load heights from the height image
+    bool HeightfieldCollider::loadFromImage(std::vector<float>& heights)
+    {
+        std::vector<uint16_t> values;
+        auto ext = fs::path(m_path).extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+        if (ext.compare(".raw") == 0 || ext.compare(".r16") == 0)
+        {
+            // Square 16-bit little endian heights
+            std::ifstream file(m_path, std::ios::binary | std::ios::ate);
+            if (!file.is_open())
+                return false;
+            auto numValues = (size_t)file.tellg() / 2;
+            auto side = (int)std::sqrt((double)numValues);
+            if (side < 2 || (size_t)side * side != numValues)
+                return false;
+            std::vector<uint8_t> bytes(numValues * 2);
+            file.seekg(0, std::ios::beg);
+            file.read((char*)bytes.data(), bytes.size());
+            values.resize(numValues);
+            for (size_t i = 0; i < numValues; ++i)
+                values[i] = (uint16_t)(bytes[i * 2] | (bytes[i * 2 + 1] << 8));
+            m_width = m_length = side;
+        }
+        else
+        {
+            int width = 0, length = 0, comp = 0;
+            auto* data = stbi_load_16(m_path.c_str(), &width, &length, &comp, 1);
+            if (data == nullptr)
+                return false;
+            if (width >= 2 && length >= 2)
+                values.assign(data, data + width * length);
+            stbi_image_free(data);
+            m_width = width;
+            m_length = length;
+        }
+
+        if (values.empty())
+            return false;
+
+        m_origin = Vec2(-m_terrainSize.X() * 0.5f, -m_terrainSize.Y() * 0.5f);
+        m_spacing = Vec2(m_terrainSize.X() / (m_width - 1), m_terrainSize.Y() / (m_length - 1));
+
+        heights.resize(values.size());
+        auto range = m_heightRange.Y() - m_heightRange.X();
+        for (size_t i = 0; i < values.size(); ++i)
+            heights[i] = m_heightRange.X() + values[i] * range / 65535.f;
+        return true;
+    }
+
+    //! Quantize heights to 16-bit
+    void HeightfieldCollider::quantizeHeights(const std::vector<float>& heights)
+    {
+        auto minmax = std::minmax_element(heights.begin(), heights.end());
+        auto halfRange = (*minmax.second - *minmax.first) * 0.5f;
+        m_heightCenter = (*minmax.first + *minmax.second) * 0.5f;
+        m_heightScale = halfRange > 0.f ? halfRange / HEIGHTFIELD_QUANTIZE_MAX : 1.f / HEIGHTFIELD_QUANTIZE_MAX;
+
+        m_heights.resize(heights.size());
+        for (size_t i = 0; i < heights.size(); ++i)
+        {
+            auto value = std::round((heights[i] - m_heightCenter) / m_heightScale);
+            m_heights[i] = (int16_t)std::clamp(value, -HEIGHTFIELD_QUANTIZE_MAX, HEIGHTFIELD_QUANTIZE_MAX);
+        }
+    }
+
+    //! Destroy collision shape
+    void HeightfieldCollider::destroyShape()
+    {
+        Collider::destroyShape();
+        m_heights.clear();
+        m_heights.shrink_to_fit();
+        m_width = m_length = 0;
+    }
+
+    //! Create collision shape
+    void HeightfieldCollider::createShape()
+    {
+        // Destroy old instance
+        destroyShape();
+
+        std::vector<float> heights;
+        auto loaded = m_path.empty() ? loadFromFigure(heights) : loadFromImage(heights);
+        if (!loaded)
+        {
+            m_width = m_length = 0;
+            return;
+        }
+        quantizeHeights(heights);
+        heights.clear();
+
+        // Bullet centers the terrain on its bounding box, the compound child transform moves it back to the grid origin
+        auto halfHeight = HEIGHTFIELD_QUANTIZE_MAX * m_heightScale;
+        auto terrainShape = std::make_shared<btHeightfieldTerrainShape>(m_width, m_length, m_heights.data(), m_heightScale, -halfHeight, halfHeight, 1, PHY_SHORT, false);
+        terrainShape->setLocalScaling(btVector3(m_spacing.X(), 1.f, m_spacing.Y()));
+
+        btTransform transform;
+        transform.setIdentity();
+        transform.setOrigin(btVector3(m_origin.X() + (m_width - 1) * m_spacing.X() * 0.5f, m_heightCenter, m_origin.Y() + (m_length - 1) * m_spacing.Y() * 0.5f));
+
+        auto compoundShape = std::make_unique<btCompoundShape>();
+        compoundShape->addChildShape(transform, terrainShape.get());
+        m_shapes.push_back(terrainShape);
+        m_shape = std::move(compoundShape);
+
+        setScale(m_scale);
+        setMargin(m_margin);
+    }
+
+    //! Serialize
+    void HeightfieldCollider::to_json(json& j) const
+    {
+        Collider::to_json(j);
+        j["path"] = getPath();
+        j["meshIdx"] = getMeshIndex();
+        j["size"] = getTerrainSize();
+        j["hRange"] = getHeightRange();
+    }
+
+    //! Deserialize
+    void HeightfieldCollider::from_json(const json& j)
+    {
+        Collider::from_json(j);
+        m_path = j.value("path", std::string());
+        m_meshIndex = j.value("meshIdx", 0);
+        m_terrainSize = j.value("size", Vec2(100.f, 100.f));
+        m_heightRange = j.value("hRange", Vec2(0.f, 10.f));
+    }
+
+    //! Update property by key value
+    void HeightfieldCollider::setProperty(const std::string& key, const json& val)
+    {
+        if (key.compare("path") == 0)
+            setPath(val);
+        else if (key.compare("meshIdx") == 0)
+            setMeshIndex(val);
+        else if (key.compare("size") == 0)
+            setTerrainSize(val);
+        else if (key.compare("hRange") == 0)
+            setHeightRange(val);
+        else
+            Collider::setProperty(key, val);
+    }
+} // namespace ige::scene
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "utils/PyxieHeaders.h"
+using namespace pyxie;
+
+#include "components/physic/Collider.h"
+
+namespace ige::scene
+{
+    //! HeightfieldCollider: terrain collider backed by btHeightfieldTerrainShape.
+    //! Heights are sampled from the figure's grid mesh, or loaded from a height image (16-bit PNG or .raw/.r16)
+    class HeightfieldCollider : public Collider
+    {
+    public:
+        //! Constructor
+        HeightfieldCollider(SceneObject& owner);
+
+        //! Destructor
+        virtual ~HeightfieldCollider();
+
+        //! Get name
+        std::string getName() const override { return "HeightfieldCollider"; }
+
+        //! Returns the type of the component
+        virtual Type getType() const override { return Type::HeightfieldCollider; }
+
+        //! Height image path, empty to sample the figure mesh
+        const std::string& getPath() const { return m_path; }
+        void setPath(const std::string& path);
+
+        //! Mesh index, used when sampling the figure mesh
+        int getMeshIndex() const { return m_meshIndex; };
+        void setMeshIndex(int idx);
+
+        //! Terrain size in X and Z, used by height image
+        const Vec2& getTerrainSize() const { return m_terrainSize; }
+        void setTerrainSize(const Vec2& size);
+
+        //! Min/max height, used by height image
+        const Vec2& getHeightRange() const { return m_heightRange; }
+        void setHeightRange(const Vec2& range);
+
+        //! Number of samples in X and Z
+        int getWidth() const { return m_width; }
+        int getLength() const { return m_length; }
+
+        //! Local position of the first sample and sample spacing, collider scale not applied
+        const Vec2& getOrigin() const { return m_origin; }
+        const Vec2& getSpacing() const { return m_spacing; }
+
+        //! Quantized heights, row major by Z
+        const std::vector<int16_t>& getHeights() const { return m_heights; }
+
+        //! Sample position in local space of the owner, collider scale applied
+        Vec3 getLocalPoint(int x, int z) const;
+
+        //! Bounding box in local space of the owner, collider scale applied
+        AABBox getLocalBoundingBox() const;
+
+        //! Update property by key value
+        virtual void setProperty(const std::string& key, const json& val) override;
+
+    protected:
+        //! Serialize
+        virtual void to_json(json& j) const override;
+        virtual void from_json(const json& j) override;
+
+        //! Create collision shape
+        virtual void createShape() override;
+
+        //! Destroy shape
+        virtual void destroyShape() override;
+
+        //! Sample heights from the figure grid mesh
+        bool loadFromFigure(std::vector<float>& heights);
+
+        //! Load heights from the height image
+        bool loadFromImage(std::vector<float>& heights);
+
+        //! Quantize heights to 16-bit
+        void quantizeHeights(const std::vector<float>& heights);
+
+    protected:
+        //! Height image path
+        std::string m_path;
+
+        //! Mesh index
+        int m_meshIndex = 0;
+
+        //! Terrain size, height image only
+        Vec2 m_terrainSize = {100.f, 100.f};
+
+        //! Height range, height image only
+        Vec2 m_heightRange = {0.f, 10.f};
+
+        //! Number of samples
+        int m_width = 0;
+        int m_length = 0;
+
+        //! Local position of the first sample and sample spacing
+        Vec2 m_origin = {0.f, 0.f};
+        Vec2 m_spacing = {1.f, 1.f};
+
+        //! Quantized heights: height = m_heightCenter + m_heights[i] * m_heightScale
+        std::vector<int16_t> m_heights;
+        float m_heightScale = 1.f;
+        float m_heightCenter = 0.f;
+    };
+} // namespace ige::scene
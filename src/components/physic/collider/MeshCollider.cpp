@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <btBulletCollisionCommon.h>
 #include <btBulletDynamicsCommon.h>
 
@@ -12,6 +14,10 @@ namespace fs = ghc::filesystem;
 
 namespace ige::scene
 {
+    //! Baked shapes waiting for their collider
+    std::unordered_map<std::string, MeshCollider::BakedShape> MeshCollider::m_bakedShapes;
+    std::mutex MeshCollider::m_bakedShapesMutex;
+
     //! Constructor
     MeshCollider::MeshCollider(SceneObject& owner)
         : Collider(owner)
@@ -90,62 +96,68 @@ namespace ige::scene
                         PYXIE_FREE_ALIGNED(palettebuffer);
                 }
             }
-            auto numPoints = (int)positions.size();
-            auto btPositions = new btVector3[numPoints];
-            m_btPositions.push_back(btPositions);
-            for (auto i = 0; i < numPoints; ++i)
-                btPositions[i] = PhysicHelper::to_btVector3(positions[i]);
+            std::vector<btVector3> points(positions.size());
+            for (size_t i = 0; i < positions.size(); ++i)
+                points[i] = PhysicHelper::to_btVector3(positions[i]);
             positions.clear();
 
             if (m_bIsConvex)
             {
-                if (m_meshIndex == -1 && m_numMesh > 1) {
-                    auto* compoundShape = (btCompoundShape*)m_shape.get();
-                    if (compoundShape) {
-                        auto convexHull = std::make_shared<btConvexHullShape>((btScalar*)btPositions, numPoints);
-                        convexHull->optimizeConvexHull();
-                        btTransform transform;
-                        transform.setIdentity();
-                        compoundShape->addChildShape(transform, convexHull.get());
-                        m_shapes.push_back(convexHull);
-                    }
-                }
-                else {
-                    auto convexHull = std::make_unique<btConvexHullShape>((btScalar*)btPositions, numPoints);
-                    convexHull->optimizeConvexHull();
-                    m_shape = std::move(convexHull);                    
-                }
+                addMeshShape(points.data(), (int)points.size(), nullptr, 0, true);
             }
             else
             {
                 auto mesh = figure->GetMesh(index);
-                auto indices = new int[mesh->numIndices];
+                std::vector<int> indices(mesh->numIndices);
                 for (uint32_t i = 0; i < mesh->numIndices; ++i)
                     indices[i] = (int)mesh->indices[i];
-                m_indices.push_back(indices);
-
-                auto indexVertexArrays = new btTriangleIndexVertexArray(mesh->numIndices / 3, indices, 3 * 4, numPoints, (btScalar*)btPositions, sizeof(btVector3));
-                m_indexVertexArrays.push_back(indexVertexArrays);
-
-                bool useQuantizedAabbCompression = true;
-                if (m_meshIndex == -1 && m_numMesh > 1) {
-                    auto* compoundShape = (btCompoundShape*)m_shape.get();
-                    if (compoundShape) {
-                        auto triangleMeshShape = std::make_shared<btBvhTriangleMeshShape>(indexVertexArrays, useQuantizedAabbCompression);
-                        btTransform transform;
-                        transform.setIdentity();
-                        compoundShape->addChildShape(transform, triangleMeshShape.get());
-                        m_shapes.push_back(triangleMeshShape);
-                    }
-                }
-                else {
-                    auto triangleMeshShape = std::make_unique<btBvhTriangleMeshShape>(indexVertexArrays, useQuantizedAabbCompression);
-                    m_shape = std::move(triangleMeshShape);
-                }
+                addMeshShape(points.data(), (int)points.size(), indices.data(), (int)indices.size(), false);
             }
         }
     }
 
+    //! Add a mesh shape, as child of the compound shape if any
+    void MeshCollider::addMeshShape(const btVector3* points, int numPoints, const int* indices, int numIndices, bool optimizeHull)
+    {
+        auto* compoundShape = (m_shape && m_shape->isCompound()) ? (btCompoundShape*)m_shape.get() : nullptr;
+        std::unique_ptr<btCollisionShape> shape;
+        if (m_bIsConvex)
+        {
+            auto convexHull = std::make_unique<btConvexHullShape>((const btScalar*)points, numPoints);
+            if (optimizeHull)
+                convexHull->optimizeConvexHull();
+            shape = std::move(convexHull);
+        }
+        else
+        {
+            auto btPositions = new btVector3[numPoints];
+            std::copy(points, points + numPoints, btPositions);
+            m_btPositions.push_back(btPositions);
+
+            auto btIndices = new int[numIndices];
+            std::copy(indices, indices + numIndices, btIndices);
+            m_indices.push_back(btIndices);
+
+            auto indexVertexArrays = new btTriangleIndexVertexArray(numIndices / 3, btIndices, 3 * 4, numPoints, (btScalar*)btPositions, sizeof(btVector3));
+            m_indexVertexArrays.push_back(indexVertexArrays);
+
+            bool useQuantizedAabbCompression = true;
+            shape = std::make_unique<btBvhTriangleMeshShape>(indexVertexArrays, useQuantizedAabbCompression);
+        }
+
+        if (compoundShape)
+        {
+            btTransform transform;
+            transform.setIdentity();
+            compoundShape->addChildShape(transform, shape.get());
+            m_shapes.push_back(std::move(shape));
+        }
+        else
+        {
+            m_shape = std::move(shape);
+        }
+    }
+
     //! Destroy collision shape
     void MeshCollider::destroyShape() {
         Collider::destroyShape();
@@ -169,10 +181,20 @@ namespace ige::scene
         // Destroy old instance
         destroyShape();
 
+        // Use baked shape if it matches the collider settings
+        {
+            std::lock_guard<std::mutex> lock(m_bakedShapesMutex);
+            auto found = m_bakedShapes.find(getOwner()->getUUID());
+            if (found != m_bakedShapes.end() && found->second.convex == m_bIsConvex && found->second.meshIndex == m_meshIndex)
+                createBakedShape(found->second);
+        }
+        if (m_shape != nullptr)
+            getOwner()->onUpdate(0.f); // force update transform
+
         // Load figure for meshes
         Figure* figure = nullptr;
         auto figureComp = getOwner()->getComponent<FigureComponent>();
-        if (figureComp) {
+        if (figureComp && m_shape == nullptr) {
             figure = figureComp->getFigure();
         }           
         
@@ -203,6 +225,92 @@ namespace ige::scene
         }
     }
 
+    //! Create shape from baked data
+    void MeshCollider::createBakedShape(const BakedShape& baked)
+    {
+        if (baked.points.empty())
+            return;
+        m_numMesh = baked.numMesh;
+        if (m_meshIndex == -1 && m_numMesh > 1)
+            m_shape = std::make_unique<btCompoundShape>();
+        for (size_t i = 0; i < baked.points.size(); ++i)
+        {
+            const auto& points = baked.points[i];
+            if (m_bIsConvex)
+            {
+                addMeshShape(points.data(), (int)points.size(), nullptr, 0, false);
+            }
+            else if (i < baked.indices.size())
+            {
+                const auto& indices = baked.indices[i];
+                addMeshShape(points.data(), (int)points.size(), indices.data(), (int)indices.size(), false);
+            }
+        }
+    }
+
+    //! Bake the current collision shape
+    bool MeshCollider::bakeShape(BakedShape& baked) const
+    {
+        if (m_shape == nullptr)
+            return false;
+        baked.meshIndex = m_meshIndex;
+        baked.numMesh = m_numMesh;
+        baked.convex = m_bIsConvex;
+        baked.points.clear();
+        baked.indices.clear();
+
+        if (m_bIsConvex)
+        {
+            std::vector<const btCollisionShape*> shapes;
+            if (m_shape->isCompound())
+                for (const auto& shape : m_shapes)
+                    shapes.push_back(shape.get());
+            else
+                shapes.push_back(m_shape.get());
+
+            // Hull points are already optimized, restoring them skips the hull computation
+            for (auto* shape : shapes)
+            {
+                auto hull = (const btConvexHullShape*)shape;
+                baked.points.emplace_back(hull->getUnscaledPoints(), hull->getUnscaledPoints() + hull->getNumPoints());
+            }
+        }
+        else
+        {
+            for (auto* indexVertexArray : m_indexVertexArrays)
+            {
+                const auto& mesh = indexVertexArray->getIndexedMeshArray()[0];
+                auto points = (const btVector3*)mesh.m_vertexBase;
+                auto indices = (const int*)mesh.m_triangleIndexBase;
+                baked.points.emplace_back(points, points + mesh.m_numVertices);
+                baked.indices.emplace_back(indices, indices + mesh.m_numTriangles * 3);
+            }
+        }
+        return !baked.points.empty();
+    }
+
+    //! Serialize finished event: the shape is final, release its baked data
+    void MeshCollider::onSerializeFinished()
+    {
+        Collider::onSerializeFinished();
+        std::lock_guard<std::mutex> lock(m_bakedShapesMutex);
+        m_bakedShapes.erase(getOwner()->getUUID());
+    }
+
+    //! Register baked shape
+    void MeshCollider::addBakedShape(const std::string& uuid, BakedShape&& baked)
+    {
+        std::lock_guard<std::mutex> lock(m_bakedShapesMutex);
+        m_bakedShapes[uuid] = std::move(baked);
+    }
+
+    //! Clear baked shapes
+    void MeshCollider::clearBakedShapes()
+    {
+        std::lock_guard<std::mutex> lock(m_bakedShapesMutex);
+        m_bakedShapes.clear();
+    }
+
     void MeshCollider::setScale(const Vec3& scale) {
         m_scale = scale;
         if(m_shape) m_shape->setLocalScaling(PhysicHelper::to_btVector3(m_scale));
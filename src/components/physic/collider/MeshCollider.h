@@ -5,6 +5,9 @@ using namespace pyxie;
 
 #include "components/physic/Collider.h"
 
+#include <mutex>
+#include <unordered_map>
+
 namespace ige::scene
 {
     //! MeshCollider
@@ -38,6 +41,26 @@ namespace ige::scene
         //! Not support scale
         virtual void setScale(const Vec3& scale) override;
 
+        //! Serialize finished event
+        virtual void onSerializeFinished() override;
+
+        //! Baked collision mesh: hull points (convex) or triangles (concave) of each sub shape
+        struct BakedShape
+        {
+            int meshIndex = -1;
+            int numMesh = 0;
+            bool convex = true;
+            std::vector<std::vector<btVector3>> points;
+            std::vector<std::vector<int>> indices;
+        };
+
+        //! Bake the current collision shape, false if there is no shape
+        bool bakeShape(BakedShape& baked) const;
+
+        //! Baked shapes by scene object UUID, createShape() uses them instead of reading the figure
+        static void addBakedShape(const std::string& uuid, BakedShape&& baked);
+        static void clearBakedShapes();
+
     protected:
         //! Serialize
         virtual void to_json(json& j) const override;
@@ -53,6 +76,12 @@ namespace ige::scene
         //! Helper to create single mesh shape
         void createSingleShape(int index);
 
+        //! Helper to add a mesh shape, as child of the compound shape if any
+        void addMeshShape(const btVector3* points, int numPoints, const int* indices, int numIndices, bool optimizeHull);
+
+        //! Helper to create shape from baked data
+        void createBakedShape(const BakedShape& baked);
+
     protected:
         //! Mesh index
         int m_meshIndex = -1;
@@ -71,5 +100,9 @@ namespace ige::scene
 
         //! Cache btPosition
         std::vector<btVector3*> m_btPositions;
+
+        //! Baked shapes waiting for their collider
+        static std::unordered_map<std::string, BakedShape> m_bakedShapes;
+        static std::mutex m_bakedShapesMutex;
     };
 } // namespace ige::scene
\ No newline at end of file
@@ -21,6 +21,9 @@ namespace ige::scene
         //! Check end of file
         bool isEof() const { return m_position >= m_size; }
 
+        //! Raw data
+        const unsigned char* data() const { return m_buffer; }
+
         //! Read bytes. Return number of read bytes;
         unsigned long read(void *dest, unsigned long size);
 
@@ -37,7 +37,9 @@
 #include "python/pySphereCollider.h"
 #include "python/pyCapsuleCollider.h"
 #include "python/pyMeshCollider.h"
+#include "python/pyHeightfieldCollider.h"
 #include "python/pySoftbody.h"
+#include "python/pyCharacterController.h"
 #include "python/pyPhysicConstraint.h"
 #include "python/pyDof6Constraint.h"
 #include "python/pyFixedConstraint.h"
@@ -221,10 +223,18 @@ PyMODINIT_FUNC PyInit_igeScene()
     Py_INCREF(&PyTypeObject_MeshCollider);
     PyModule_AddObject(module, "MeshCollider", (PyObject*)&PyTypeObject_MeshCollider);
 
+    if (PyType_Ready(&PyTypeObject_HeightfieldCollider) < 0) return NULL;
+    Py_INCREF(&PyTypeObject_HeightfieldCollider);
+    PyModule_AddObject(module, "HeightfieldCollider", (PyObject*)&PyTypeObject_HeightfieldCollider);
+
     if (PyType_Ready(&PyTypeObject_Softbody) < 0) return NULL;
     Py_INCREF(&PyTypeObject_Softbody);
     PyModule_AddObject(module, "Softbody", (PyObject*)&PyTypeObject_Softbody);
 
+    if (PyType_Ready(&PyTypeObject_CharacterController) < 0) return NULL;
+    Py_INCREF(&PyTypeObject_CharacterController);
+    PyModule_AddObject(module, "CharacterController", (PyObject*)&PyTypeObject_CharacterController);
+
     if (PyType_Ready(&PyTypeObject_PhysicConstraint) < 0) return NULL;
     Py_INCREF(&PyTypeObject_PhysicConstraint);
     PyModule_AddObject(module, "PhysicConstraint", (PyObject*)&PyTypeObject_PhysicConstraint);
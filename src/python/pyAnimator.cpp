@@ -2,6 +2,7 @@
 #include "python/pyAnimator_doc_en.h"
 
 #include "components/animation/AnimatorController.h"
+#include "components/animation/AnimatorControllerInstance.h"
 #include "components/animation/AnimatorStateMachine.h"
 
 #include "utils/PyxieHeaders.h"
@@ -47,34 +48,34 @@ namespace ige::scene
     PyObject* Animator_isInitialized(PyObject_Animator* self)
     {
         if (self->component.expired()) Py_RETURN_NONE;
-        return PyBool_FromLong(std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getController() != nullptr);
+        return PyBool_FromLong(std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getInstance() != nullptr);
     }
 
     //! getParameterCount
     PyObject* Animator_getParameterCount(PyObject_Animator* self)
     {
         if (self->component.expired()) Py_RETURN_NONE;
-        auto controller = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getController();
-        if(controller == nullptr) Py_RETURN_NONE;
-        return PyLong_FromLong(controller->getParameters().size());
+        auto instance = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getInstance();
+        if(instance == nullptr) Py_RETURN_NONE;
+        return PyLong_FromLong(instance->getParameterCount());
     }
 
     //! speed
     PyObject* Animator_getSpeed(PyObject_Animator* self)
     {
         if (self->component.expired()) Py_RETURN_NONE;
-        auto controller = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getController();
-        if (controller == nullptr) Py_RETURN_NONE;
-        return PyFloat_FromDouble(controller->getTimeScale());
+        auto instance = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getInstance();
+        if (instance == nullptr) Py_RETURN_NONE;
+        return PyFloat_FromDouble(instance->getTimeScale());
     }
     int Animator_setSpeed(PyObject_Animator* self, PyObject* value)
     {
         if (self->component.expired()) return -1;
         if (PyFloat_Check(value)) {
             float val = (float)PyFloat_AsDouble(value);
-            auto controller = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getController();
-            if (controller == nullptr) return -1;
-            controller->setTimeScale(val);
+            auto instance = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getInstance();
+            if (instance == nullptr) return -1;
+            instance->setTimeScale(val);
             return 0;
         }
         return -1;
@@ -101,6 +102,103 @@ namespace ige::scene
         return -1;
     }
 
+    //! cullingMode
+    PyObject* Animator_getCullingMode(PyObject_Animator* self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
+        if (animator == nullptr) Py_RETURN_NONE;
+        return PyLong_FromLong((int)animator->getCullingMode());
+    }
+    int Animator_setCullingMode(PyObject_Animator* self, PyObject* value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (int)PyLong_AsLong(value);
+            auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
+            if (animator == nullptr) return -1;
+            animator->setCullingMode((AnimatorComponent::CullingMode)val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! lodDistances
+    PyObject* Animator_getLodDistances(PyObject_Animator* self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
+        if (animator == nullptr) Py_RETURN_NONE;
+        auto vec2Obj = PyObject_New(vec_obj, _Vec2Type);
+        vmath_cpy(animator->getLodDistances().P(), 2, vec2Obj->v);
+        vec2Obj->d = 2;
+        return (PyObject*)vec2Obj;
+    }
+    int Animator_setLodDistances(PyObject_Animator* self, PyObject* value)
+    {
+        if (self->component.expired()) return -1;
+        int d;
+        float buff[4];
+        auto v = pyObjToFloat((PyObject*)value, buff, d);
+        if (!v) return -1;
+        auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
+        if (animator == nullptr) return -1;
+        animator->setLodDistances(*((Vec2*)v));
+        return 0;
+    }
+
+    //! lodInterval
+    PyObject* Animator_getLodInterval(PyObject_Animator* self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
+        if (animator == nullptr) Py_RETURN_NONE;
+        return PyLong_FromLong(animator->getLodInterval());
+    }
+    int Animator_setLodInterval(PyObject_Animator* self, PyObject* value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (int)PyLong_AsLong(value);
+            auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
+            if (animator == nullptr) return -1;
+            animator->setLodInterval(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! maxCatchUpTime
+    PyObject* Animator_getMaxCatchUpTime(PyObject_Animator* self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
+        if (animator == nullptr) Py_RETURN_NONE;
+        return PyFloat_FromDouble(animator->getMaxCatchUpTime());
+    }
+
+    int Animator_setMaxCatchUpTime(PyObject_Animator* self, PyObject* value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyFloat_Check(value) || PyLong_Check(value)) {
+            auto val = (float)PyFloat_AsDouble(value);
+            auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
+            if (animator == nullptr) return -1;
+            animator->setMaxCatchUpTime(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! isVisible
+    PyObject* Animator_isVisible(PyObject_Animator* self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
+        if (animator == nullptr) Py_RETURN_NONE;
+        return PyBool_FromLong(animator->isVisible());
+    }
+
     //! Get value
     PyObject* Animator_getValue(PyObject_Animator* self, PyObject* value)
     {
@@ -108,9 +206,9 @@ namespace ige::scene
         char* param = {};
         if (PyArg_ParseTuple(value, "s", &param)) {
             if (param != nullptr && strlen(param) > 0) {
-                auto controller = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getController();
-                if (controller) {
-                    auto [type, val] = controller->getParameter(std::string((const char*)param));
+                auto instance = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getInstance();
+                if (instance) {
+                    auto [type, val] = instance->getParameter(std::string((const char*)param));
                     if (type == AnimatorParameterType::Bool || type == AnimatorParameterType::Trigger)
                         return PyBool_FromLong(val != 0);
                     if (type == AnimatorParameterType::Float)
@@ -131,21 +229,21 @@ namespace ige::scene
         PyObject* pyVal = nullptr;
         if (PyArg_ParseTuple(value, "sO", &param, &pyVal)) {
             if (param != nullptr && strlen(param) > 0) {
-                auto controller = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getController();
-                if (controller) {
+                auto instance = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getInstance();
+                if (instance) {
                     if (PyBool_Check(pyVal)) {
                         auto val = (bool)PyLong_AsLong(pyVal);
-                        controller->setParameter(std::string((const char*)param), (int)AnimatorParameterType::Bool, val ? 1.f : 0.f);
+                        instance->setParameter(std::string((const char*)param), (int)AnimatorParameterType::Bool, val ? 1.f : 0.f);
                         Py_RETURN_TRUE;
                     }
                     else if (PyLong_Check(pyVal)) {
                         auto val = PyLong_AsLong(pyVal);
-                        controller->setParameter(std::string((const char*)param), (int)AnimatorParameterType::Int, val);
+                        instance->setParameter(std::string((const char*)param), (int)AnimatorParameterType::Int, val);
                         Py_RETURN_TRUE;
                     }
                     else if (PyFloat_Check(pyVal)) {
                         auto val = PyFloat_AsDouble(pyVal);
-                        controller->setParameter(std::string((const char*)param), (int)AnimatorParameterType::Float, val);
+                        instance->setParameter(std::string((const char*)param), (int)AnimatorParameterType::Float, val);
                         Py_RETURN_TRUE;
                     }                    
                 }
@@ -161,9 +259,9 @@ namespace ige::scene
         char* param = {};
         if (PyArg_ParseTuple(value, "s", &param)) {
             if (param != nullptr && strlen(param) > 0) {
-                auto controller = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getController();
-                if (controller) {
-                    controller->setParameter(std::string((const char*)param), (int)AnimatorParameterType::Trigger, 1.f);
+                auto instance = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getInstance();
+                if (instance) {
+                    instance->setParameter(std::string((const char*)param), (int)AnimatorParameterType::Trigger, 1.f);
                     Py_RETURN_TRUE;
                 }
             }
@@ -178,9 +276,9 @@ namespace ige::scene
         char* param = {};
         if (PyArg_ParseTuple(value, "s", &param)) {
             if (param != nullptr && strlen(param) > 0) {
-                auto controller = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getController();
-                if (controller) {
-                    controller->setParameter(std::string((const char*)param), (int)AnimatorParameterType::Trigger, 0.f);
+                auto instance = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock())->getInstance();
+                if (instance) {
+                    instance->setParameter(std::string((const char*)param), (int)AnimatorParameterType::Trigger, 0.f);
                     Py_RETURN_TRUE;
                 }
             }
@@ -209,9 +307,9 @@ namespace ige::scene
             if (state != nullptr && strlen(state) > 0) {
                 auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
                 if (animator) {
-                    auto controller = animator->getController();
-                    if (controller) {
-                        return PyBool_FromLong(controller->getStateMachine()->hasState(std::string((const char*)state)));
+                    auto instance = animator->getInstance();
+                    if (instance) {
+                        return PyBool_FromLong(instance->hasState(std::string((const char*)state)));
                     }
                 }
             }
@@ -228,11 +326,9 @@ namespace ige::scene
             if (state != nullptr && strlen(state) > 0) {
                 auto animator = std::dynamic_pointer_cast<AnimatorComponent>(self->component.lock());
                 if (animator) {
-                    auto controller = animator->getController();
-                    if (controller) {
-                        auto statePtr = controller->getStateMachine()->findState(std::string((const char*)state));
-                        if (statePtr) {
-                            controller->getStateMachine()->setCurrentState(statePtr);
+                    auto instance = animator->getInstance();
+                    if (instance) {
+                        if (instance->play(std::string((const char*)state))) {
                             Py_RETURN_TRUE;
                         }
                     }
@@ -261,6 +357,11 @@ namespace ige::scene
         {"parameterCount", (getter)Animator_getParameterCount, NULL, Animator_parameterCount_doc, NULL},
         {"speed", (getter)Animator_getSpeed, (setter)Animator_setSpeed, Animator_speed_doc, NULL},
         {"updateMode", (getter)Animator_getUpdateMode, (setter)Animator_setUpdateMode, Animator_updateMode_doc, NULL},
+        {"cullingMode", (getter)Animator_getCullingMode, (setter)Animator_setCullingMode, Animator_cullingMode_doc, NULL},
+        {"lodDistances", (getter)Animator_getLodDistances, (setter)Animator_setLodDistances, Animator_lodDistances_doc, NULL},
+        {"lodInterval", (getter)Animator_getLodInterval, (setter)Animator_setLodInterval, Animator_lodInterval_doc, NULL},
+        {"maxCatchUpTime", (getter)Animator_getMaxCatchUpTime, (setter)Animator_setMaxCatchUpTime, Animator_maxCatchUpTime_doc, NULL},
+        {"isVisible", (getter)Animator_isVisible, NULL, Animator_isVisible_doc, NULL},
         {NULL, NULL}};
 
     PyTypeObject PyTypeObject_Animator = {
@@ -38,6 +38,25 @@ namespace ige::scene
     PyObject *Animator_getUpdateMode(PyObject_Animator *self);
     int Animator_setUpdateMode(PyObject_Animator *self, PyObject *value);
 
+    //! cullingMode
+    PyObject *Animator_getCullingMode(PyObject_Animator *self);
+    int Animator_setCullingMode(PyObject_Animator *self, PyObject *value);
+
+    //! lodDistances
+    PyObject *Animator_getLodDistances(PyObject_Animator *self);
+    int Animator_setLodDistances(PyObject_Animator *self, PyObject *value);
+
+    //! lodInterval
+    PyObject *Animator_getLodInterval(PyObject_Animator *self);
+    int Animator_setLodInterval(PyObject_Animator *self, PyObject *value);
+
+    //! maxCatchUpTime
+    PyObject *Animator_getMaxCatchUpTime(PyObject_Animator *self);
+    int Animator_setMaxCatchUpTime(PyObject_Animator *self, PyObject *value);
+
+    //! isVisible
+    PyObject *Animator_isVisible(PyObject_Animator *self);
+
     //! Get value
     PyObject* Animator_getValue(PyObject_Animator* self, PyObject* value);
 
@@ -27,6 +27,31 @@ PyDoc_STRVAR(Animator_updateMode_doc,
              "Animation update mode: Normal = 0, AnimatePhysics = 1, UnscaledTime = 2.\n"
              "Type: int\n");
 
+// cullingMode
+PyDoc_STRVAR(Animator_cullingMode_doc,
+             "Off-screen culling mode: AlwaysAnimate = 0, CullUpdate = 1, CullCompletely = 2.\n"
+             "Type: int\n");
+
+// lodDistances
+PyDoc_STRVAR(Animator_lodDistances_doc,
+             "Camera distances beyond which the animation updates every 2nd frame and every lodInterval frames. 0 disables.\n"
+             "Type: Vec2\n");
+
+// lodInterval
+PyDoc_STRVAR(Animator_lodInterval_doc,
+             "Update interval of far and culled animations, in frames.\n"
+             "Type: int\n");
+
+// maxCatchUpTime
+PyDoc_STRVAR(Animator_maxCatchUpTime_doc,
+             "Off-screen time the figure catches up with CullUpdate once visible again, in seconds. Longer time is dropped, 0 drops all of it.\n"
+             "Type: float\n");
+
+// isVisible
+PyDoc_STRVAR(Animator_isVisible_doc,
+             "Whether the animated object was inside the camera frustum in the last update.\n"
+             "Type: bool\n");
+
 // getValue
 PyDoc_STRVAR(Animator_getValue_doc,
     "Get value of the given parameter.\n"
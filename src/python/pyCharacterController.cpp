@@ -0,0 +1,337 @@
+#include "python/pyCharacterController.h"
+#include "python/pyCharacterController_doc_en.h"
+
+#include "components/physic/CharacterController.h"
+
+#include "utils/PyxieHeaders.h"
+using namespace pyxie;
+
+#include <pyVectorMath.h>
+#include <pythonResource.h>
+
+namespace ige::scene
+{
+    void CharacterController_dealloc(PyObject_CharacterController *self)
+    {
+        if (self) {
+            self->component.reset();
+            Py_TYPE(self)->tp_free(self);
+        }
+    }
+
+    PyObject *CharacterController_str(PyObject_CharacterController *self)
+    {
+        return PyUnicode_FromString("C++ CharacterController object");
+    }
+
+    //! Move
+    PyObject *CharacterController_move(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        PyObject* pyObj = nullptr;
+        if (PyArg_ParseTuple(value, "O", &pyObj)) {
+            if (pyObj) {
+                int d;
+                float buff[4];
+                auto v = pyObjToFloat((PyObject*)pyObj, buff, d);
+                if (v && d >= 3) {
+                    std::dynamic_pointer_cast<CharacterController>(self->component.lock())->move(*((Vec3*)v));
+                }
+            }
+        }
+        Py_RETURN_NONE;
+    }
+
+    //! Jump
+    PyObject *CharacterController_jump(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        PyObject* pyObj = nullptr;
+        if (PyArg_ParseTuple(value, "|O", &pyObj)) {
+            if (pyObj) {
+                int d;
+                float buff[4];
+                auto v = pyObjToFloat((PyObject*)pyObj, buff, d);
+                if (v && d >= 3) {
+                    std::dynamic_pointer_cast<CharacterController>(self->component.lock())->jump(*((Vec3*)v));
+                }
+            }
+            else {
+                std::dynamic_pointer_cast<CharacterController>(self->component.lock())->jump();
+            }
+        }
+        Py_RETURN_NONE;
+    }
+
+    //! Warp
+    PyObject *CharacterController_warp(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        PyObject* pyObj = nullptr;
+        if (PyArg_ParseTuple(value, "O", &pyObj)) {
+            if (pyObj) {
+                int d;
+                float buff[4];
+                auto v = pyObjToFloat((PyObject*)pyObj, buff, d);
+                if (v && d >= 3) {
+                    std::dynamic_pointer_cast<CharacterController>(self->component.lock())->warp(*((Vec3*)v));
+                }
+            }
+        }
+        Py_RETURN_NONE;
+    }
+
+    //! Capsule radius
+    PyObject *CharacterController_getRadius(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyFloat_FromDouble(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->getRadius());
+    }
+
+    int CharacterController_setRadius(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyFloat_Check(value) || PyLong_Check(value)) {
+            float val = (float)PyFloat_AsDouble(value);
+            std::dynamic_pointer_cast<CharacterController>(self->component.lock())->setRadius(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Capsule height, without the caps
+    PyObject *CharacterController_getHeight(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyFloat_FromDouble(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->getHeight());
+    }
+
+    int CharacterController_setHeight(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyFloat_Check(value) || PyLong_Check(value)) {
+            float val = (float)PyFloat_AsDouble(value);
+            std::dynamic_pointer_cast<CharacterController>(self->component.lock())->setHeight(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Max height of steps to climb
+    PyObject *CharacterController_getStepHeight(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyFloat_FromDouble(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->getStepHeight());
+    }
+
+    int CharacterController_setStepHeight(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyFloat_Check(value) || PyLong_Check(value)) {
+            float val = (float)PyFloat_AsDouble(value);
+            std::dynamic_pointer_cast<CharacterController>(self->component.lock())->setStepHeight(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Max walkable slope, in degrees
+    PyObject *CharacterController_getMaxSlope(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyFloat_FromDouble(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->getMaxSlope());
+    }
+
+    int CharacterController_setMaxSlope(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyFloat_Check(value) || PyLong_Check(value)) {
+            float val = (float)PyFloat_AsDouble(value);
+            std::dynamic_pointer_cast<CharacterController>(self->component.lock())->setMaxSlope(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Jump speed
+    PyObject *CharacterController_getJumpSpeed(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyFloat_FromDouble(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->getJumpSpeed());
+    }
+
+    int CharacterController_setJumpSpeed(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyFloat_Check(value) || PyLong_Check(value)) {
+            float val = (float)PyFloat_AsDouble(value);
+            std::dynamic_pointer_cast<CharacterController>(self->component.lock())->setJumpSpeed(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Max fall speed
+    PyObject *CharacterController_getFallSpeed(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyFloat_FromDouble(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->getFallSpeed());
+    }
+
+    int CharacterController_setFallSpeed(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyFloat_Check(value) || PyLong_Check(value)) {
+            float val = (float)PyFloat_AsDouble(value);
+            std::dynamic_pointer_cast<CharacterController>(self->component.lock())->setFallSpeed(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Collision filter group
+    PyObject *CharacterController_getCollisionFilterGroup(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->getCollisionFilterGroup());
+    }
+
+    int CharacterController_setCollisionFilterGroup(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (int)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<CharacterController>(self->component.lock())->setCollisionFilterGroup(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Collision filter mask
+    PyObject *CharacterController_getCollisionFilterMask(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->getCollisionFilterMask());
+    }
+
+    int CharacterController_setCollisionFilterMask(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (int)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<CharacterController>(self->component.lock())->setCollisionFilterMask(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Capsule offset
+    PyObject *CharacterController_getOffset(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto vec3Obj = PyObject_New(vec_obj, _Vec3Type);
+        vmath_cpy(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->getOffset().P(), 3, vec3Obj->v);
+        vec3Obj->d = 3;
+        return (PyObject *)vec3Obj;
+    }
+
+    int CharacterController_setOffset(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        int d;
+        float buff[4];
+        auto v = pyObjToFloat((PyObject *)value, buff, d);
+        if (!v || d < 3) return -1;
+        std::dynamic_pointer_cast<CharacterController>(self->component.lock())->setOffset(*((Vec3 *)v));
+        return 0;
+    }
+
+    //! Move velocity
+    PyObject *CharacterController_getVelocity(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto vec3Obj = PyObject_New(vec_obj, _Vec3Type);
+        vmath_cpy(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->getVelocity().P(), 3, vec3Obj->v);
+        vec3Obj->d = 3;
+        return (PyObject *)vec3Obj;
+    }
+
+    int CharacterController_setVelocity(PyObject_CharacterController *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        int d;
+        float buff[4];
+        auto v = pyObjToFloat((PyObject *)value, buff, d);
+        if (!v || d < 3) return -1;
+        std::dynamic_pointer_cast<CharacterController>(self->component.lock())->move(*((Vec3 *)v));
+        return 0;
+    }
+
+    //! Grounded state
+    PyObject *CharacterController_isGrounded(PyObject_CharacterController *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyBool_FromLong(std::dynamic_pointer_cast<CharacterController>(self->component.lock())->isGrounded());
+    }
+
+    PyMethodDef CharacterController_methods[] = {
+        {"move", (PyCFunction)CharacterController_move, METH_VARARGS, CharacterController_move_doc},
+        {"jump", (PyCFunction)CharacterController_jump, METH_VARARGS, CharacterController_jump_doc},
+        {"warp", (PyCFunction)CharacterController_warp, METH_VARARGS, CharacterController_warp_doc},
+        {NULL, NULL}};
+
+    PyGetSetDef CharacterController_getsets[] = {
+        {"radius", (getter)CharacterController_getRadius, (setter)CharacterController_setRadius, CharacterController_radius_doc, NULL},
+        {"height", (getter)CharacterController_getHeight, (setter)CharacterController_setHeight, CharacterController_height_doc, NULL},
+        {"stepHeight", (getter)CharacterController_getStepHeight, (setter)CharacterController_setStepHeight, CharacterController_stepHeight_doc, NULL},
+        {"maxSlope", (getter)CharacterController_getMaxSlope, (setter)CharacterController_setMaxSlope, CharacterController_maxSlope_doc, NULL},
+        {"jumpSpeed", (getter)CharacterController_getJumpSpeed, (setter)CharacterController_setJumpSpeed, CharacterController_jumpSpeed_doc, NULL},
+        {"fallSpeed", (getter)CharacterController_getFallSpeed, (setter)CharacterController_setFallSpeed, CharacterController_fallSpeed_doc, NULL},
+        {"collisionGroup", (getter)CharacterController_getCollisionFilterGroup, (setter)CharacterController_setCollisionFilterGroup, CharacterController_collisionGroup_doc, NULL},
+        {"collisionMask", (getter)CharacterController_getCollisionFilterMask, (setter)CharacterController_setCollisionFilterMask, CharacterController_collisionMask_doc, NULL},
+        {"offset", (getter)CharacterController_getOffset, (setter)CharacterController_setOffset, CharacterController_offset_doc, NULL},
+        {"velocity", (getter)CharacterController_getVelocity, (setter)CharacterController_setVelocity, CharacterController_velocity_doc, NULL},
+        {"isGrounded", (getter)CharacterController_isGrounded, NULL, CharacterController_isGrounded_doc, NULL},
+        {NULL, NULL}};
+
+    PyTypeObject PyTypeObject_CharacterController = {
+        PyVarObject_HEAD_INIT(NULL, 1) "igeScene.CharacterController", /* tp_name */
+        sizeof(PyObject_CharacterController),                          /* tp_basicsize */
+        0,                                                    /* tp_itemsize */
+        (destructor)CharacterController_dealloc,                       /* tp_dealloc */
+        0,                                                    /* tp_print */
+        0,                                                    /* tp_getattr */
+        0,                                                    /* tp_setattr */
+        0,                                                    /* tp_reserved */
+        0,                                                    /* tp_repr */
+        0,                                                    /* tp_as_number */
+        0,                                                    /* tp_as_sequence */
+        0,                                                    /* tp_as_mapping */
+        0,                                                    /* tp_hash */
+        0,                                                    /* tp_call */
+        (reprfunc)CharacterController_str,                           /* tp_str */
+        0,                                                    /* tp_getattro */
+        0,                                                    /* tp_setattro */
+        0,                                                    /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                                   /* tp_flags */
+        0,                                                    /* tp_doc */
+        0,                                                    /* tp_traverse */
+        0,                                                    /* tp_clear */
+        0,                                                    /* tp_richcompare */
+        0,                                                    /* tp_weaklistoffset */
+        0,                                                    /* tp_iter */
+        0,                                                    /* tp_iternext */
+        CharacterController_methods,                                   /* tp_methods */
+        0,                                                    /* tp_members */
+        CharacterController_getsets,                                 /* tp_getset */
+        &PyTypeObject_Component,                              /* tp_base */
+        0,                                                    /* tp_dict */
+        0,                                                    /* tp_descr_get */
+        0,                                                    /* tp_descr_set */
+        0,                                                    /* tp_dictoffset */
+        0,                                                    /* tp_init */
+        0,                                                    /* tp_alloc */
+        0,                                                    /* tp_new */
+        0,                                                    /* tp_free */
+    };
+} // namespace ige::scene
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Python.h>
+
+#include "components/Component.h"
+#include "components/physic/CharacterController.h"
+
+#include "python/pyComponent.h"
+
+namespace ige::scene
+{
+    struct PyObject_CharacterController : PyObject_Component {};
+
+    // Type declaration
+    extern PyTypeObject PyTypeObject_CharacterController;
+
+    // Dealloc
+    void CharacterController_dealloc(PyObject_CharacterController *self);
+
+    // String represent
+    PyObject *CharacterController_str(PyObject_CharacterController *self);
+
+    //! Move with the velocity, kept until changed
+    PyObject *CharacterController_move(PyObject_CharacterController *self, PyObject *value);
+
+    //! Jump
+    PyObject *CharacterController_jump(PyObject_CharacterController *self, PyObject *value);
+
+    //! Teleport
+    PyObject *CharacterController_warp(PyObject_CharacterController *self, PyObject *value);
+
+    //! Capsule radius
+    PyObject *CharacterController_getRadius(PyObject_CharacterController *self);
+    int CharacterController_setRadius(PyObject_CharacterController *self, PyObject *value);
+
+    //! Capsule height, without the caps
+    PyObject *CharacterController_getHeight(PyObject_CharacterController *self);
+    int CharacterController_setHeight(PyObject_CharacterController *self, PyObject *value);
+
+    //! Max height of steps to climb
+    PyObject *CharacterController_getStepHeight(PyObject_CharacterController *self);
+    int CharacterController_setStepHeight(PyObject_CharacterController *self, PyObject *value);
+
+    //! Max walkable slope, in degrees
+    PyObject *CharacterController_getMaxSlope(PyObject_CharacterController *self);
+    int CharacterController_setMaxSlope(PyObject_CharacterController *self, PyObject *value);
+
+    //! Jump speed
+    PyObject *CharacterController_getJumpSpeed(PyObject_CharacterController *self);
+    int CharacterController_setJumpSpeed(PyObject_CharacterController *self, PyObject *value);
+
+    //! Max fall speed
+    PyObject *CharacterController_getFallSpeed(PyObject_CharacterController *self);
+    int CharacterController_setFallSpeed(PyObject_CharacterController *self, PyObject *value);
+
+    //! Collision filter group
+    PyObject *CharacterController_getCollisionFilterGroup(PyObject_CharacterController *self);
+    int CharacterController_setCollisionFilterGroup(PyObject_CharacterController *self, PyObject *value);
+
+    //! Collision filter mask
+    PyObject *CharacterController_getCollisionFilterMask(PyObject_CharacterController *self);
+    int CharacterController_setCollisionFilterMask(PyObject_CharacterController *self, PyObject *value);
+
+    //! Capsule offset
+    PyObject *CharacterController_getOffset(PyObject_CharacterController *self);
+    int CharacterController_setOffset(PyObject_CharacterController *self, PyObject *value);
+
+    //! Move velocity
+    PyObject *CharacterController_getVelocity(PyObject_CharacterController *self);
+    int CharacterController_setVelocity(PyObject_CharacterController *self, PyObject *value);
+
+    //! Grounded state
+    PyObject *CharacterController_isGrounded(PyObject_CharacterController *self);
+} // namespace ige::scene
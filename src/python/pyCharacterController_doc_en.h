@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Python.h>
+
+// move
+PyDoc_STRVAR(CharacterController_move_doc,
+             "Move with the velocity. The velocity is kept until changed.\n"
+             "\n"
+             "Parameters\n"
+             "----------\n"
+             "    velocity : Vec3\n"
+             "        move velocity, in units per second\n");
+
+// jump
+PyDoc_STRVAR(CharacterController_jump_doc,
+             "Jump if the character can jump.\n"
+             "\n"
+             "Parameters\n"
+             "----------\n"
+             "    [Optional]velocity : Vec3\n"
+             "        jump velocity, or jumpSpeed along the up axis\n");
+
+// warp
+PyDoc_STRVAR(CharacterController_warp_doc,
+             "Teleport to the position.\n"
+             "\n"
+             "Parameters\n"
+             "----------\n"
+             "    position : Vec3\n"
+             "        target position\n");
+
+// radius
+PyDoc_STRVAR(CharacterController_radius_doc,
+             "Capsule radius.\n"
+             "Type: float\n");
+
+// height
+PyDoc_STRVAR(CharacterController_height_doc,
+             "Capsule height, without the caps.\n"
+             "Type: float\n");
+
+// stepHeight
+PyDoc_STRVAR(CharacterController_stepHeight_doc,
+             "Max height of steps to climb.\n"
+             "Type: float\n");
+
+// maxSlope
+PyDoc_STRVAR(CharacterController_maxSlope_doc,
+             "Max walkable slope, in degrees.\n"
+             "Type: float\n");
+
+// jumpSpeed
+PyDoc_STRVAR(CharacterController_jumpSpeed_doc,
+             "Jump speed.\n"
+             "Type: float\n");
+
+// fallSpeed
+PyDoc_STRVAR(CharacterController_fallSpeed_doc,
+             "Max fall speed.\n"
+             "Type: float\n");
+
+// collisionGroup
+PyDoc_STRVAR(CharacterController_collisionGroup_doc,
+             "Collision filter group.\n"
+             "Type: int\n");
+
+// collisionMask
+PyDoc_STRVAR(CharacterController_collisionMask_doc,
+             "Collision filter mask.\n"
+             "Type: int\n");
+
+// offset
+PyDoc_STRVAR(CharacterController_offset_doc,
+             "Capsule center offset from the object position.\n"
+             "Type: Vec3\n");
+
+// velocity
+PyDoc_STRVAR(CharacterController_velocity_doc,
+             "Move velocity.\n"
+             "Type: Vec3\n");
+
+// isGrounded
+PyDoc_STRVAR(CharacterController_isGrounded_doc,
+             "Whether the character stands on the ground. Readonly.\n"
+             "Type: bool\n");
@@ -56,15 +56,113 @@ namespace ige::scene
         return -1;
     }
 
+    //! Tile budget
+    PyObject *DynamicNavMesh_getTileBudget(PyObject_DynamicNavMesh *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong(std::dynamic_pointer_cast<DynamicNavMesh>(self->component.lock())->getTileBudget());
+    }
+
+    int DynamicNavMesh_setTileBudget(PyObject_DynamicNavMesh *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (int)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<DynamicNavMesh>(self->component.lock())->setTileBudget(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Time budget
+    PyObject *DynamicNavMesh_getTimeBudget(PyObject_DynamicNavMesh *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyFloat_FromDouble(std::dynamic_pointer_cast<DynamicNavMesh>(self->component.lock())->getTimeBudget());
+    }
+
+    int DynamicNavMesh_setTimeBudget(PyObject_DynamicNavMesh *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyFloat_Check(value)) {
+            float val = (float)PyFloat_AsDouble(value);
+            std::dynamic_pointer_cast<DynamicNavMesh>(self->component.lock())->setTimeBudget(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Collect NavObstacle objects from a list or tuple
+    static bool DynamicNavMesh_parseObstacles(PyObject *args, std::vector<NavObstacle*>& obstacles)
+    {
+        PyObject *listObj = nullptr;
+        if (!PyArg_ParseTuple(args, "O", &listObj))
+            return false;
+
+        auto seq = PySequence_Fast(listObj, "expected a list of NavObstacle");
+        if (!seq)
+            return false;
+
+        auto count = PySequence_Fast_GET_SIZE(seq);
+        for (Py_ssize_t i = 0; i < count; ++i)
+        {
+            auto item = PySequence_Fast_GET_ITEM(seq, i);
+            if (PyObject_IsInstance(item, (PyObject *)&PyTypeObject_NavObstacle))
+            {
+                auto obj = (PyObject_NavObstacle *)item;
+                if (!obj->component.expired())
+                    obstacles.push_back(std::dynamic_pointer_cast<NavObstacle>(obj->component.lock()).get());
+            }
+        }
+        Py_DECREF(seq);
+        return true;
+    }
+
+    //! Batch obstacle requests
+    PyObject *DynamicNavMesh_addObstacles(PyObject_DynamicNavMesh *self, PyObject *args)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        std::vector<NavObstacle*> obstacles;
+        if (!DynamicNavMesh_parseObstacles(args, obstacles))
+            return NULL;
+        std::dynamic_pointer_cast<DynamicNavMesh>(self->component.lock())->addObstacles(obstacles);
+        Py_RETURN_NONE;
+    }
+
+    PyObject *DynamicNavMesh_removeObstacles(PyObject_DynamicNavMesh *self, PyObject *args)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        std::vector<NavObstacle*> obstacles;
+        if (!DynamicNavMesh_parseObstacles(args, obstacles))
+            return NULL;
+        std::dynamic_pointer_cast<DynamicNavMesh>(self->component.lock())->removeObstacles(obstacles);
+        Py_RETURN_NONE;
+    }
+
+    PyObject *DynamicNavMesh_moveObstacles(PyObject_DynamicNavMesh *self, PyObject *args)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        std::vector<NavObstacle*> obstacles;
+        if (!DynamicNavMesh_parseObstacles(args, obstacles))
+            return NULL;
+        std::dynamic_pointer_cast<DynamicNavMesh>(self->component.lock())->moveObstacles(obstacles);
+        Py_RETURN_NONE;
+    }
+
     // Get/set
     PyGetSetDef DynamicNavMesh_getsets[] = {
         {"maxObstacles", (getter)DynamicNavMesh_getMaxObstacles, (setter)DynamicNavMesh_setMaxObstacles, DynamicNavMesh_maxObstacles_doc, NULL},
         {"maxLayers", (getter)DynamicNavMesh_getMaxLayers, (setter)DynamicNavMesh_setMaxLayers, DynamicNavMesh_maxLayers_doc, NULL},
+        {"tileBudget", (getter)DynamicNavMesh_getTileBudget, (setter)DynamicNavMesh_setTileBudget, DynamicNavMesh_tileBudget_doc, NULL},
+        {"timeBudget", (getter)DynamicNavMesh_getTimeBudget, (setter)DynamicNavMesh_setTimeBudget, DynamicNavMesh_timeBudget_doc, NULL},
         {NULL, NULL},
     };
 
     // Methods
     PyMethodDef DynamicNavMesh_methods[] = {
+        {"addObstacles", (PyCFunction)DynamicNavMesh_addObstacles, METH_VARARGS, DynamicNavMesh_addObstacles_doc},
+        {"removeObstacles", (PyCFunction)DynamicNavMesh_removeObstacles, METH_VARARGS, DynamicNavMesh_removeObstacles_doc},
+        {"moveObstacles", (PyCFunction)DynamicNavMesh_moveObstacles, METH_VARARGS, DynamicNavMesh_moveObstacles_doc},
         {NULL, NULL},
     };
 
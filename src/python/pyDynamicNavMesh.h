@@ -7,6 +7,7 @@
 
 #include "python/pyComponent.h"
 #include "python/pyNavMesh.h"
+#include "python/pyNavObstacle.h"
 
 namespace ige::scene
 {
@@ -29,4 +30,17 @@ namespace ige::scene
     PyObject *DynamicNavMesh_getMaxLayers(PyObject_DynamicNavMesh *self);
     int DynamicNavMesh_setMaxLayers(PyObject_DynamicNavMesh *self, PyObject *value);
 
+    //! Tile budget
+    PyObject *DynamicNavMesh_getTileBudget(PyObject_DynamicNavMesh *self);
+    int DynamicNavMesh_setTileBudget(PyObject_DynamicNavMesh *self, PyObject *value);
+
+    //! Time budget
+    PyObject *DynamicNavMesh_getTimeBudget(PyObject_DynamicNavMesh *self);
+    int DynamicNavMesh_setTimeBudget(PyObject_DynamicNavMesh *self, PyObject *value);
+
+    //! Batch obstacle requests
+    PyObject *DynamicNavMesh_addObstacles(PyObject_DynamicNavMesh *self, PyObject *args);
+    PyObject *DynamicNavMesh_removeObstacles(PyObject_DynamicNavMesh *self, PyObject *args);
+    PyObject *DynamicNavMesh_moveObstacles(PyObject_DynamicNavMesh *self, PyObject *args);
+
 } // namespace ige::scene
@@ -12,6 +12,37 @@ PyDoc_STRVAR(DynamicNavMesh_maxLayers_doc,
              "Max number of layers.\n"
              "Type: int\n");
 
+// tileBudget
+PyDoc_STRVAR(DynamicNavMesh_tileBudget_doc,
+             "Max number of tiles rebuilt per update after obstacle changes.\n"
+             "Type: int\n");
+
+// timeBudget
+PyDoc_STRVAR(DynamicNavMesh_timeBudget_doc,
+             "Max time spent rebuilding tiles per update, in milliseconds.\n"
+             "Type: float\n");
+
+// addObstacles
+PyDoc_STRVAR(DynamicNavMesh_addObstacles_doc,
+             "Queue obstacles to add to the tile cache.\n"
+             "\n"
+             "Parameters:\n"
+             "    obstacles: list of NavObstacle\n");
+
+// removeObstacles
+PyDoc_STRVAR(DynamicNavMesh_removeObstacles_doc,
+             "Queue obstacles to remove from the tile cache.\n"
+             "\n"
+             "Parameters:\n"
+             "    obstacles: list of NavObstacle\n");
+
+// moveObstacles
+PyDoc_STRVAR(DynamicNavMesh_moveObstacles_doc,
+             "Queue enabled obstacles to move to their current transform.\n"
+             "\n"
+             "Parameters:\n"
+             "    obstacles: list of NavObstacle\n");
+
 // build
 PyDoc_STRVAR(DynamicNavMesh_build_doc,
              "Build the entire dynamic navigation mesh.\n"
@@ -0,0 +1,167 @@
+#include "python/pyHeightfieldCollider.h"
+#include "python/pyHeightfieldCollider_doc_en.h"
+
+#include "components/physic/collider/HeightfieldCollider.h"
+
+#include "utils/PyxieHeaders.h"
+using namespace pyxie;
+
+#include <pyVectorMath.h>
+#include <pythonResource.h>
+
+namespace ige::scene
+{
+    void HeightfieldCollider_dealloc(PyObject_HeightfieldCollider *self)
+    {
+        if (self) {
+            self->component.reset();
+            Py_TYPE(self)->tp_free(self);
+        }
+    }
+
+    PyObject *HeightfieldCollider_str(PyObject_HeightfieldCollider *self)
+    {
+        return PyUnicode_FromString("C++ HeightfieldCollider object");
+    }
+
+    //! Height image path
+    PyObject *HeightfieldCollider_getPath(PyObject_HeightfieldCollider *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyUnicode_FromString(std::dynamic_pointer_cast<HeightfieldCollider>(self->component.lock())->getPath().c_str());
+    }
+
+    int HeightfieldCollider_setPath(PyObject_HeightfieldCollider *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyUnicode_Check(value)) {
+            const char* val = PyUnicode_AsUTF8(value);
+            std::dynamic_pointer_cast<HeightfieldCollider>(self->component.lock())->setPath(std::string(val));
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Mesh index
+    PyObject *HeightfieldCollider_getMeshIndex(PyObject_HeightfieldCollider *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong(std::dynamic_pointer_cast<HeightfieldCollider>(self->component.lock())->getMeshIndex());
+    }
+
+    int HeightfieldCollider_setMeshIndex(PyObject_HeightfieldCollider *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (int)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<HeightfieldCollider>(self->component.lock())->setMeshIndex(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Terrain size
+    PyObject *HeightfieldCollider_getTerrainSize(PyObject_HeightfieldCollider *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto vec2Obj = PyObject_New(vec_obj, _Vec2Type);
+        vmath_cpy(std::dynamic_pointer_cast<HeightfieldCollider>(self->component.lock())->getTerrainSize().P(), 2, vec2Obj->v);
+        vec2Obj->d = 2;
+        return (PyObject *)vec2Obj;
+    }
+
+    int HeightfieldCollider_setTerrainSize(PyObject_HeightfieldCollider *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        int d;
+        float buff[4];
+        auto v = pyObjToFloat((PyObject *)value, buff, d);
+        if (!v) return -1;
+        std::dynamic_pointer_cast<HeightfieldCollider>(self->component.lock())->setTerrainSize(*((Vec2 *)v));
+        return 0;
+    }
+
+    //! Height range
+    PyObject *HeightfieldCollider_getHeightRange(PyObject_HeightfieldCollider *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto vec2Obj = PyObject_New(vec_obj, _Vec2Type);
+        vmath_cpy(std::dynamic_pointer_cast<HeightfieldCollider>(self->component.lock())->getHeightRange().P(), 2, vec2Obj->v);
+        vec2Obj->d = 2;
+        return (PyObject *)vec2Obj;
+    }
+
+    int HeightfieldCollider_setHeightRange(PyObject_HeightfieldCollider *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        int d;
+        float buff[4];
+        auto v = pyObjToFloat((PyObject *)value, buff, d);
+        if (!v) return -1;
+        std::dynamic_pointer_cast<HeightfieldCollider>(self->component.lock())->setHeightRange(*((Vec2 *)v));
+        return 0;
+    }
+
+    //! Number of samples
+    PyObject *HeightfieldCollider_getWidth(PyObject_HeightfieldCollider *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong(std::dynamic_pointer_cast<HeightfieldCollider>(self->component.lock())->getWidth());
+    }
+
+    PyObject *HeightfieldCollider_getLength(PyObject_HeightfieldCollider *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong(std::dynamic_pointer_cast<HeightfieldCollider>(self->component.lock())->getLength());
+    }
+
+    PyGetSetDef HeightfieldCollider_getsets[] = {
+        {"path", (getter)HeightfieldCollider_getPath, (setter)HeightfieldCollider_setPath, HeightfieldCollider_path_doc, NULL},
+        {"meshIndex", (getter)HeightfieldCollider_getMeshIndex, (setter)HeightfieldCollider_setMeshIndex, HeightfieldCollider_meshIndex_doc, NULL},
+        {"terrainSize", (getter)HeightfieldCollider_getTerrainSize, (setter)HeightfieldCollider_setTerrainSize, HeightfieldCollider_terrainSize_doc, NULL},
+        {"heightRange", (getter)HeightfieldCollider_getHeightRange, (setter)HeightfieldCollider_setHeightRange, HeightfieldCollider_heightRange_doc, NULL},
+        {"width", (getter)HeightfieldCollider_getWidth, NULL, HeightfieldCollider_width_doc, NULL},
+        {"length", (getter)HeightfieldCollider_getLength, NULL, HeightfieldCollider_length_doc, NULL},
+        {NULL, NULL}};
+
+    PyTypeObject PyTypeObject_HeightfieldCollider = {
+        PyVarObject_HEAD_INIT(NULL, 1) "igeScene.HeightfieldCollider", /* tp_name */
+        sizeof(PyObject_HeightfieldCollider),                          /* tp_basicsize */
+        0,                                                    /* tp_itemsize */
+        (destructor)HeightfieldCollider_dealloc,                       /* tp_dealloc */
+        0,                                                    /* tp_print */
+        0,                                                    /* tp_getattr */
+        0,                                                    /* tp_setattr */
+        0,                                                    /* tp_reserved */
+        0,                                                    /* tp_repr */
+        0,                                                    /* tp_as_number */
+        0,                                                    /* tp_as_sequence */
+        0,                                                    /* tp_as_mapping */
+        0,                                                    /* tp_hash */
+        0,                                                    /* tp_call */
+        (reprfunc)HeightfieldCollider_str,                           /* tp_str */
+        0,                                                    /* tp_getattro */
+        0,                                                    /* tp_setattro */
+        0,                                                    /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                                   /* tp_flags */
+        0,                                                    /* tp_doc */
+        0,                                                    /* tp_traverse */
+        0,                                                    /* tp_clear */
+        0,                                                    /* tp_richcompare */
+        0,                                                    /* tp_weaklistoffset */
+        0,                                                    /* tp_iter */
+        0,                                                    /* tp_iternext */
+        0,                                                    /* tp_methods */
+        0,                                                    /* tp_members */
+        HeightfieldCollider_getsets,                                 /* tp_getset */
+        &PyTypeObject_Component,                              /* tp_base */
+        0,                                                    /* tp_dict */
+        0,                                                    /* tp_descr_get */
+        0,                                                    /* tp_descr_set */
+        0,                                                    /* tp_dictoffset */
+        0,                                                    /* tp_init */
+        0,                                                    /* tp_alloc */
+        0,                                                    /* tp_new */
+        0,                                                    /* tp_free */
+    };
+} // namespace ige::scene
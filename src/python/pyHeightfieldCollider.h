@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Python.h>
+
+#include "components/Component.h"
+#include "components/physic/collider/HeightfieldCollider.h"
+
+#include "python/pyRigidbody.h"
+
+namespace ige::scene
+{
+    struct PyObject_HeightfieldCollider : PyObject_Component {};
+
+    // Type declaration
+    extern PyTypeObject PyTypeObject_HeightfieldCollider;
+
+    // Dealloc
+    void HeightfieldCollider_dealloc(PyObject_HeightfieldCollider *self);
+
+    // String represent
+    PyObject *HeightfieldCollider_str(PyObject_HeightfieldCollider *self);
+
+    //! Height image path
+    PyObject *HeightfieldCollider_getPath(PyObject_HeightfieldCollider *self);
+    int HeightfieldCollider_setPath(PyObject_HeightfieldCollider *self, PyObject *value);
+
+    //! Mesh index
+    PyObject *HeightfieldCollider_getMeshIndex(PyObject_HeightfieldCollider *self);
+    int HeightfieldCollider_setMeshIndex(PyObject_HeightfieldCollider *self, PyObject *value);
+
+    //! Terrain size
+    PyObject *HeightfieldCollider_getTerrainSize(PyObject_HeightfieldCollider *self);
+    int HeightfieldCollider_setTerrainSize(PyObject_HeightfieldCollider *self, PyObject *value);
+
+    //! Height range
+    PyObject *HeightfieldCollider_getHeightRange(PyObject_HeightfieldCollider *self);
+    int HeightfieldCollider_setHeightRange(PyObject_HeightfieldCollider *self, PyObject *value);
+
+    //! Number of samples
+    PyObject *HeightfieldCollider_getWidth(PyObject_HeightfieldCollider *self);
+    PyObject *HeightfieldCollider_getLength(PyObject_HeightfieldCollider *self);
+} // namespace ige::scene
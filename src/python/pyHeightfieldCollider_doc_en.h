@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Python.h>
+
+// path
+PyDoc_STRVAR(HeightfieldCollider_path_doc,
+             "Height image path (16-bit PNG, .raw or .r16). Empty to sample the figure grid mesh.\n"
+             "Type: string\n");
+
+// meshIndex
+PyDoc_STRVAR(HeightfieldCollider_meshIndex_doc,
+             "Index of the figure mesh sampled for heights.\n"
+             "Type: int\n");
+
+// terrainSize
+PyDoc_STRVAR(HeightfieldCollider_terrainSize_doc,
+             "Terrain size in X and Z, used by height image.\n"
+             "Type: Vec2\n");
+
+// heightRange
+PyDoc_STRVAR(HeightfieldCollider_heightRange_doc,
+             "Min and max height, used by height image.\n"
+             "Type: Vec2\n");
+
+// width
+PyDoc_STRVAR(HeightfieldCollider_width_doc,
+             "Number of samples in X. Readonly.\n"
+             "Type: int\n");
+
+// length
+PyDoc_STRVAR(HeightfieldCollider_length_doc,
+             "Number of samples in Z. Readonly.\n"
+             "Type: int\n");
@@ -154,6 +154,24 @@ namespace ige::scene
         return -1;
     }
 
+    //! Use flow field
+    PyObject *NavAgent_isUseFlowField(PyObject_NavAgent *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyBool_FromLong(std::dynamic_pointer_cast<NavAgent>(self->component.lock())->isUseFlowField());
+    }
+
+    int NavAgent_setUseFlowField(PyObject_NavAgent *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (uint32_t)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<NavAgent>(self->component.lock())->setUseFlowField(val);
+            return 0;
+        }
+        return -1;
+    }
+
     //! Query filter type
     PyObject *NavAgent_getQueryFilterType(PyObject_NavAgent *self)
     {
@@ -283,6 +301,7 @@ namespace ige::scene
         {"maxAcceleration", (getter)NavAgent_getMaxAcceleration, (setter)NavAgent_setMaxAcceleration, NavAgent_maxAcceleration_doc, NULL},
         {"targetPosition", (getter)NavAgent_getTargetPosition, (setter)NavAgent_setTargetPosition, NavAgent_targetPosition_doc, NULL},
         {"autoUpdatePosition", (getter)NavAgent_isUpdateNodePosition, (setter)NavAgent_setUpdateNodePosition, NavAgent_autoUpdatePosition_doc, NULL},
+        {"useFlowField", (getter)NavAgent_isUseFlowField, (setter)NavAgent_setUseFlowField, NavAgent_useFlowField_doc, NULL},
         {"queryFilterType", (getter)NavAgent_getQueryFilterType, (setter)NavAgent_setQueryFilterType, NavAgent_queryFilterType_doc, NULL},
         {"obstacleAvoidanceType", (getter)NavAgent_getObstacleAvoidanceType, (setter)NavAgent_setObstacleAvoidanceType, NavAgent_obstacleAvoidanceType_doc, NULL},
         {"navigationPushiness", (getter)NavAgent_getNavigationPushiness, (setter)NavAgent_setNavigationPushiness, NavAgent_navigationPushiness_doc, NULL},
@@ -48,6 +48,10 @@ namespace ige::scene
     PyObject *NavAgent_isUpdateNodePosition(PyObject_NavAgent *self);
     int NavAgent_setUpdateNodePosition(PyObject_NavAgent *self, PyObject *value);
 
+    //! Use flow field
+    PyObject *NavAgent_isUseFlowField(PyObject_NavAgent *self);
+    int NavAgent_setUseFlowField(PyObject_NavAgent *self, PyObject *value);
+
     //! Query filter type
     PyObject *NavAgent_getQueryFilterType(PyObject_NavAgent *self);
     int NavAgent_setQueryFilterType(PyObject_NavAgent *self, PyObject *value);
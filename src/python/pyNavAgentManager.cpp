@@ -88,6 +88,63 @@ namespace ige::scene
         return -1;
     }
 
+    //! LOD enabled
+    PyObject *NavAgentManager_isLodEnabled(PyObject_NavAgentManager *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyBool_FromLong(std::dynamic_pointer_cast<NavAgentManager>(self->component.lock())->isLodEnabled());
+    }
+
+    int NavAgentManager_setLodEnabled(PyObject_NavAgentManager *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (uint32_t)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<NavAgentManager>(self->component.lock())->setLodEnabled(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! LOD distances
+    PyObject *NavAgentManager_getLodDistances(PyObject_NavAgentManager *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto vec2Obj = PyObject_New(vec_obj, _Vec2Type);
+        vmath_cpy(std::dynamic_pointer_cast<NavAgentManager>(self->component.lock())->getLodDistances().P(), 2, vec2Obj->v);
+        vec2Obj->d = 2;
+        return (PyObject *)vec2Obj;
+    }
+
+    int NavAgentManager_setLodDistances(PyObject_NavAgentManager *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        int d;
+        float buff[4];
+        auto v = pyObjToFloat((PyObject *)value, buff, d);
+        if (!v) return -1;
+        std::dynamic_pointer_cast<NavAgentManager>(self->component.lock())->setLodDistances(*((Vec2 *)v));
+        return 0;
+    }
+
+    //! Low LOD update interval
+    PyObject *NavAgentManager_getLowLodInterval(PyObject_NavAgentManager *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong(std::dynamic_pointer_cast<NavAgentManager>(self->component.lock())->getLowLodInterval());
+    }
+
+    int NavAgentManager_setLowLodInterval(PyObject_NavAgentManager *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (int)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<NavAgentManager>(self->component.lock())->setLowLodInterval(val);
+            return 0;
+        }
+        return -1;
+    }
+
     //! getNumQueryFilterTypes
     PyObject *NavAgentManager_getNumQueryFilterTypes(PyObject_NavAgentManager *self)
     {
@@ -261,6 +318,72 @@ namespace ige::scene
         return (PyObject*)pyList;
     }
 
+    //! requestPath
+    PyObject *NavAgentManager_requestPath(PyObject_NavAgentManager *self, PyObject *value)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        PyObject* startObj = nullptr;
+        PyObject* endObj = nullptr;
+        int type;
+        int priority = 0;
+        uint32_t ticket = 0;
+        if (PyArg_ParseTuple(value, "OOi|i", &startObj, &endObj, &type, &priority))
+        {
+            int d1, d2;
+            float buff1[4], buff2[4];
+            auto start = pyObjToFloat((PyObject *)startObj, buff1, d1);
+            auto end = pyObjToFloat((PyObject *)endObj, buff2, d2);
+            if (start && end)
+                ticket = std::dynamic_pointer_cast<NavAgentManager>(self->component.lock())->requestPath(*((Vec3 *)start), *((Vec3 *)end), type, priority);
+        }
+        return PyLong_FromUnsignedLong(ticket);
+    }
+
+    //! cancelPath
+    PyObject *NavAgentManager_cancelPath(PyObject_NavAgentManager *self, PyObject *value)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        uint32_t ticket = 0;
+        if (PyArg_ParseTuple(value, "I", &ticket))
+        {
+            if (std::dynamic_pointer_cast<NavAgentManager>(self->component.lock())->cancelPath(ticket))
+                Py_RETURN_TRUE;
+        }
+        Py_RETURN_FALSE;
+    }
+
+    //! getPathStatus
+    PyObject *NavAgentManager_getPathStatus(PyObject_NavAgentManager *self, PyObject *value)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        uint32_t ticket = 0;
+        auto status = NavMesh::EPathStatus::INVALID;
+        if (PyArg_ParseTuple(value, "I", &ticket))
+            status = std::dynamic_pointer_cast<NavAgentManager>(self->component.lock())->getPathStatus(ticket);
+        return PyLong_FromLong((int)status);
+    }
+
+    //! getPathResult
+    PyObject *NavAgentManager_getPathResult(PyObject_NavAgentManager *self, PyObject *value)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        uint32_t ticket = 0;
+        std::vector<Vec3> points;
+        if (!PyArg_ParseTuple(value, "I", &ticket) || !std::dynamic_pointer_cast<NavAgentManager>(self->component.lock())->getPathResult(ticket, points))
+            Py_RETURN_NONE;
+
+        PyObject* pyList = PyList_New(0);
+        for(int i = 0; i < points.size(); ++i)
+        {
+            auto vec3Obj = PyObject_New(vec_obj, _Vec3Type);
+            vmath_cpy(points[i].P(), 3, vec3Obj->v);
+            vec3Obj->d = 3;
+            PyList_Append(pyList, (PyObject*)vec3Obj);
+            Py_XDECREF(vec3Obj);
+        }
+        return (PyObject*)pyList;
+    }
+
     //! getRandomPoint
     PyObject *NavAgentManager_getRandomPoint(PyObject_NavAgentManager *self, PyObject *value)
     {
@@ -359,6 +482,9 @@ namespace ige::scene
         {"navMesh", (getter)NavAgentManager_getNavMesh, (setter)NavAgentManager_setNavMesh, NavAgentManager_navMesh_doc, NULL},
         {"maxAgentNumber", (getter)NavAgentManager_getMaxAgentNumber, (setter)NavAgentManager_setMaxAgentNumber, NavAgentManager_maxAgentNumber_doc, NULL},
         {"maxAgentRadius", (getter)NavAgentManager_getMaxAgentRadius, (setter)NavAgentManager_setMaxAgentRadius, NavAgentManager_maxAgentRadius_doc, NULL},
+        {"lodEnabled", (getter)NavAgentManager_isLodEnabled, (setter)NavAgentManager_setLodEnabled, NavAgentManager_lodEnabled_doc, NULL},
+        {"lodDistances", (getter)NavAgentManager_getLodDistances, (setter)NavAgentManager_setLodDistances, NavAgentManager_lodDistances_doc, NULL},
+        {"lowLodInterval", (getter)NavAgentManager_getLowLodInterval, (setter)NavAgentManager_setLowLodInterval, NavAgentManager_lowLodInterval_doc, NULL},
         {NULL, NULL},
     };
 
@@ -376,6 +502,10 @@ namespace ige::scene
         {"findNearestPoint", (PyCFunction)NavAgentManager_findNearestPoint, METH_VARARGS, NavAgentManager_findNearestPoint_doc},
         {"moveAlongSurface", (PyCFunction)NavAgentManager_moveAlongSurface, METH_VARARGS, NavAgentManager_moveAlongSurface_doc},
         {"findPath", (PyCFunction)NavAgentManager_findPath, METH_VARARGS, NavAgentManager_findPath_doc},
+        {"requestPath", (PyCFunction)NavAgentManager_requestPath, METH_VARARGS, NavAgentManager_requestPath_doc},
+        {"cancelPath", (PyCFunction)NavAgentManager_cancelPath, METH_VARARGS, NavAgentManager_cancelPath_doc},
+        {"getPathStatus", (PyCFunction)NavAgentManager_getPathStatus, METH_VARARGS, NavAgentManager_getPathStatus_doc},
+        {"getPathResult", (PyCFunction)NavAgentManager_getPathResult, METH_VARARGS, NavAgentManager_getPathResult_doc},
         {"getRandomPoint", (PyCFunction)NavAgentManager_getRandomPoint, METH_VARARGS, NavAgentManager_getRandomPoint_doc},
         {"getRandomPointInCircle", (PyCFunction)NavAgentManager_getRandomPointInCircle, METH_VARARGS, NavAgentManager_getRandomPointInCircle_doc},
         {"getDistanceToWall", (PyCFunction)NavAgentManager_getDistanceToWall, METH_VARARGS, NavAgentManager_getDistanceToWall_doc},
@@ -32,6 +32,18 @@ namespace ige::scene
     PyObject *NavAgentManager_getMaxAgentRadius(PyObject_NavAgentManager *self);
     int NavAgentManager_setMaxAgentRadius(PyObject_NavAgentManager *self, PyObject *value);
 
+    //! LOD enabled
+    PyObject *NavAgentManager_isLodEnabled(PyObject_NavAgentManager *self);
+    int NavAgentManager_setLodEnabled(PyObject_NavAgentManager *self, PyObject *value);
+
+    //! LOD distances
+    PyObject *NavAgentManager_getLodDistances(PyObject_NavAgentManager *self);
+    int NavAgentManager_setLodDistances(PyObject_NavAgentManager *self, PyObject *value);
+
+    //! Low LOD update interval
+    PyObject *NavAgentManager_getLowLodInterval(PyObject_NavAgentManager *self);
+    int NavAgentManager_setLowLodInterval(PyObject_NavAgentManager *self, PyObject *value);
+
     //! getNumQueryFilterTypes
     PyObject *NavAgentManager_getNumQueryFilterTypes(PyObject_NavAgentManager *self);
 
@@ -68,6 +80,18 @@ namespace ige::scene
     //! findPath
     PyObject *NavAgentManager_findPath(PyObject_NavAgentManager *self, PyObject* value);
 
+    //! requestPath
+    PyObject *NavAgentManager_requestPath(PyObject_NavAgentManager *self, PyObject* value);
+
+    //! cancelPath
+    PyObject *NavAgentManager_cancelPath(PyObject_NavAgentManager *self, PyObject* value);
+
+    //! getPathStatus
+    PyObject *NavAgentManager_getPathStatus(PyObject_NavAgentManager *self, PyObject* value);
+
+    //! getPathResult
+    PyObject *NavAgentManager_getPathResult(PyObject_NavAgentManager *self, PyObject* value);
+
     //! getRandomPoint
     PyObject *NavAgentManager_getRandomPoint(PyObject_NavAgentManager *self, PyObject* value);
 
@@ -17,6 +17,21 @@ PyDoc_STRVAR(NavAgentManager_maxAgentRadius_doc,
              "Max radius of agents.\n"
              "Type: float\n");
 
+// lodEnabled
+PyDoc_STRVAR(NavAgentManager_lodEnabled_doc,
+             "Agent LOD: far or off-screen agents drop obstacle avoidance, query fewer neighbours and skip crowd updates.\n"
+             "Type: bool\n");
+
+// lodDistances
+PyDoc_STRVAR(NavAgentManager_lodDistances_doc,
+             "Distances from the active camera where agents switch to medium and to low LOD.\n"
+             "Type: Vec2\n");
+
+// lowLodInterval
+PyDoc_STRVAR(NavAgentManager_lowLodInterval_doc,
+             "Low LOD agents are updated by the crowd once every interval frames.\n"
+             "Type: int\n");
+
 // getQueryFiltersNumber
 PyDoc_STRVAR(NavAgentManager_getQueryFiltersNumber_doc,
              "Return the number of query filters configured in the crowd. Limit to 16.\n"
@@ -158,6 +173,57 @@ PyDoc_STRVAR(NavAgentManager_findPath_doc,
              "Return: list of path points.\n"
              "    Type: list<Vec3>\n");
 
+// requestPath
+PyDoc_STRVAR(NavAgentManager_requestPath_doc,
+             "Queue a time-sliced path query using the crowd initialized query extent and the specified query filter type.\n"
+             "Queries are searched on update within the NavMesh path iteration budget, higher priority first.\n"
+             "\n"
+             "Parameters:\n"
+             "    start: start point\n"
+             "        Type: Vec3\n"
+             "    end: end point\n"
+             "        Type: Vec3\n"
+             "    queryFilterType: filter type\n"
+             "        Type: int\n"
+             "    priority: request priority, optional\n"
+             "        Type: int\n"
+             "\n"
+             "Return: ticket of the request, 0 if rejected.\n"
+             "    Type: int\n");
+
+// cancelPath
+PyDoc_STRVAR(NavAgentManager_cancelPath_doc,
+             "Cancel a queued or running path request.\n"
+             "\n"
+             "Parameters:\n"
+             "    ticket: request ticket\n"
+             "        Type: int\n"
+             "\n"
+             "Return: True if the request was found.\n"
+             "    Type: bool\n");
+
+// getPathStatus
+PyDoc_STRVAR(NavAgentManager_getPathStatus_doc,
+             "Return status of the path request: INVALID = 0, PENDING = 1, COMPLETED = 2, FAILED = 3.\n"
+             "\n"
+             "Parameters:\n"
+             "    ticket: request ticket\n"
+             "        Type: int\n"
+             "\n"
+             "Return: request status.\n"
+             "    Type: int\n");
+
+// getPathResult
+PyDoc_STRVAR(NavAgentManager_getPathResult_doc,
+             "Take the result of a finished path request, the ticket is released. Results not taken within 300 updates are released.\n"
+             "\n"
+             "Parameters:\n"
+             "    ticket: request ticket\n"
+             "        Type: int\n"
+             "\n"
+             "Return: list of path points, empty if the search failed, None while pending or if the ticket is unknown.\n"
+             "    Type: list<Vec3>\n");
+
 // getRandomPoint
 PyDoc_STRVAR(NavAgentManager_getRandomPoint_doc,
              "Return a random point on the navigation mesh using the crowd initialized query extent and the specified query filter type.\n"
@@ -37,6 +37,11 @@ PyDoc_STRVAR(NavAgent_autoUpdatePosition_doc,
              "Agent auto update position\n"
              "Type: bool\n");
 
+// useFlowField
+PyDoc_STRVAR(NavAgent_useFlowField_doc,
+             "Follow the flow field shared by agents heading to the same target, instead of a private path\n"
+             "Type: bool\n");
+
 // queryFilterType
 PyDoc_STRVAR(NavAgent_queryFilterType_doc,
              "Agent query filter type\n"
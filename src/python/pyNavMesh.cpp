@@ -298,6 +298,44 @@ namespace ige::scene
         return 0;
     }
 
+    //! Bake
+    PyObject *NavMesh_getBakeEnabled(PyObject_NavMesh *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyBool_FromLong(std::dynamic_pointer_cast<NavMesh>(self->component.lock())->isBakeEnabled());
+    }
+
+    int NavMesh_setBakeEnabled(PyObject_NavMesh *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value))
+        {
+            auto val = (uint32_t)PyLong_AsLong(value) != 0;
+            std::dynamic_pointer_cast<NavMesh>(self->component.lock())->setBakeEnabled(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    //! Path iteration budget
+    PyObject *NavMesh_getPathIterationBudget(PyObject_NavMesh *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong(std::dynamic_pointer_cast<NavMesh>(self->component.lock())->getPathIterationBudget());
+    }
+
+    int NavMesh_setPathIterationBudget(PyObject_NavMesh *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value))
+        {
+            auto val = (int)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<NavMesh>(self->component.lock())->setPathIterationBudget(val);
+            return 0;
+        }
+        return -1;
+    }
+
     //! Build
     PyObject *NavMesh_build(PyObject_NavMesh *self)
     {
@@ -307,6 +345,57 @@ namespace ige::scene
         Py_RETURN_FALSE;
     }
 
+    //! Build async
+    PyObject *NavMesh_buildAsync(PyObject_NavMesh *self, PyObject *args)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        PyObject *minObj = nullptr, *maxObj = nullptr;
+        if (!PyArg_ParseTuple(args, "OO", &minObj, &maxObj))
+        {
+            PyErr_SetString(PyExc_TypeError, "[buildAsync] Parameter error!");
+            return NULL;
+        }
+
+        int d1, d2;
+        float buff1[4], buff2[4];
+        auto v1 = pyObjToFloat(minObj, buff1, d1);
+        auto v2 = pyObjToFloat(maxObj, buff2, d2);
+        if (!v1 || !v2)
+        {
+            PyErr_SetString(PyExc_TypeError, "[buildAsync] Parameter error!");
+            return NULL;
+        }
+        std::dynamic_pointer_cast<NavMesh>(self->component.lock())->buildAsync(AABBox(*((Vec3 *)v1), *((Vec3 *)v2)));
+        Py_RETURN_NONE;
+    }
+
+    //! Is building async
+    PyObject *NavMesh_isBuildingAsync(PyObject_NavMesh *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyBool_FromLong(std::dynamic_pointer_cast<NavMesh>(self->component.lock())->isBuildingAsync());
+    }
+
+    //! Override flags of polygons with the area ID
+    PyObject *NavMesh_setAreaFlags(PyObject_NavMesh *self, PyObject *args)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        int areaId, flags;
+        if (PyArg_ParseTuple(args, "ii", &areaId, &flags))
+            std::dynamic_pointer_cast<NavMesh>(self->component.lock())->setAreaFlags((uint8_t)areaId, (uint16_t)flags);
+        Py_RETURN_NONE;
+    }
+
+    //! Restore built flags of polygons with the area ID
+    PyObject *NavMesh_resetAreaFlags(PyObject_NavMesh *self, PyObject *args)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        int areaId;
+        if (PyArg_ParseTuple(args, "i", &areaId))
+            std::dynamic_pointer_cast<NavMesh>(self->component.lock())->resetAreaFlags((uint8_t)areaId);
+        Py_RETURN_NONE;
+    }
+
     //! Get AABB
     PyObject *NavMesh_getAABB(PyObject_NavMesh *self)
     {
@@ -416,12 +505,18 @@ namespace ige::scene
         {"detailSampleMaxError", (getter)NavMesh_getDetailSampleMaxError, (setter)NavMesh_setDetailSampleMaxError, NavMesh_detDetailSampleMaxError_doc, NULL},
         {"aabbPading", (getter)NavMesh_getPadding, (setter)NavMesh_setPadding, NavMesh_aabbPading_doc, NULL},
         {"partitionType", (getter)NavMesh_getPartitionType, (setter)NavMesh_setPartitionType, NavMesh_partitionType_doc, NULL},
+        {"bake", (getter)NavMesh_getBakeEnabled, (setter)NavMesh_setBakeEnabled, NavMesh_bake_doc, NULL},
+        {"pathIterationBudget", (getter)NavMesh_getPathIterationBudget, (setter)NavMesh_setPathIterationBudget, NavMesh_pathIterationBudget_doc, NULL},
         {NULL, NULL},
     };
 
     // Methods
     PyMethodDef NavMesh_methods[] = {
         {"build", (PyCFunction)NavMesh_build, METH_NOARGS, NavMesh_build_doc},
+        {"buildAsync", (PyCFunction)NavMesh_buildAsync, METH_VARARGS, NavMesh_buildAsync_doc},
+        {"isBuildingAsync", (PyCFunction)NavMesh_isBuildingAsync, METH_NOARGS, NavMesh_isBuildingAsync_doc},
+        {"setAreaFlags", (PyCFunction)NavMesh_setAreaFlags, METH_VARARGS, NavMesh_setAreaFlags_doc},
+        {"resetAreaFlags", (PyCFunction)NavMesh_resetAreaFlags, METH_VARARGS, NavMesh_resetAreaFlags_doc},
         {"getAABB", (PyCFunction)NavMesh_getAABB, METH_NOARGS, NavMesh_getAABB_doc},
         {"getWorldAABB", (PyCFunction)NavMesh_getWorldAABB, METH_NOARGS, NavMesh_getWorldAABB_doc},
         {"getNumTiles", (PyCFunction)NavMesh_getNumTiles, METH_NOARGS, NavMesh_getNumTiles_doc},
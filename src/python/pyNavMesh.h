@@ -80,8 +80,22 @@ namespace ige::scene
     PyObject *NavMesh_getPadding(PyObject_NavMesh *self);
     int NavMesh_setPadding(PyObject_NavMesh *self, PyObject *value);
 
+    // Bake
+    PyObject *NavMesh_getBakeEnabled(PyObject_NavMesh *self);
+    int NavMesh_setBakeEnabled(PyObject_NavMesh *self, PyObject *value);
+
+    // Path iteration budget
+    PyObject *NavMesh_getPathIterationBudget(PyObject_NavMesh *self);
+    int NavMesh_setPathIterationBudget(PyObject_NavMesh *self, PyObject *value);
+
     //! Build
     PyObject *NavMesh_build(PyObject_NavMesh *self);
+    PyObject *NavMesh_buildAsync(PyObject_NavMesh *self, PyObject *args);
+    PyObject *NavMesh_isBuildingAsync(PyObject_NavMesh *self);
+
+    //! Area flags
+    PyObject *NavMesh_setAreaFlags(PyObject_NavMesh *self, PyObject *args);
+    PyObject *NavMesh_resetAreaFlags(PyObject_NavMesh *self, PyObject *args);
 
     //! Get AABB
     PyObject *NavMesh_getAABB(PyObject_NavMesh *self);
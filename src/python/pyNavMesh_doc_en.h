@@ -93,6 +93,18 @@ PyDoc_STRVAR(NavMesh_partitionType_doc,
              "   Type: int\n"
              "   Default: 0\n");
 
+// bake
+PyDoc_STRVAR(NavMesh_bake_doc,
+             "Persist built tiles next to the scene file when the scene is saved, and load them instead of rebuilding while geometry and settings are unchanged.\n"
+             "   Type: bool\n"
+             "   Default: True\n");
+
+// pathIterationBudget
+PyDoc_STRVAR(NavMesh_pathIterationBudget_doc,
+             "Max sliced search iterations per update, shared by all queued path requests.\n"
+             "   Type: int\n"
+             "   Default: 256\n");
+
 // build
 PyDoc_STRVAR(NavMesh_build_doc,
              "Build the entire navigation mesh.\n"
@@ -100,6 +112,52 @@ PyDoc_STRVAR(NavMesh_build_doc,
              "Return:\n"
              "    Type: bool\n");
 
+// buildAsync
+PyDoc_STRVAR(NavMesh_buildAsync_doc,
+             "Queue a rebuild of the tiles touched by a world-space bounding box.\n"
+             "Tiles are built on worker threads and swapped in on a later update, agents keep using the old tiles until then.\n"
+             "Overlapping requests are coalesced.\n"
+             "\n"
+             "NavMesh.buildAsync(aabbMin, aabbMax)\n"
+             "\n"
+             "Parameters\n"
+             "----------\n"
+             "    aabbMin: Vec3\n"
+             "        Minimum corner of the bounding box\n"
+             "    aabbMax: Vec3\n"
+             "        Maximum corner of the bounding box\n");
+
+// isBuildingAsync
+PyDoc_STRVAR(NavMesh_isBuildingAsync_doc,
+             "Return whether an async rebuild is queued or running.\n"
+             "\n"
+             "Return:\n"
+             "    Type: bool\n");
+
+// setAreaFlags
+PyDoc_STRVAR(NavMesh_setAreaFlags_doc,
+             "Override flags of every polygon with the area ID, kept across tile rebuilds.\n"
+             "\n"
+             "NavMesh.setAreaFlags(areaId, flags)\n"
+             "\n"
+             "Parameters\n"
+             "----------\n"
+             "    areaId: int\n"
+             "        Navigation area ID\n"
+             "    flags: int\n"
+             "        Polygon flags, matched against the query filter include and exclude flags\n");
+
+// resetAreaFlags
+PyDoc_STRVAR(NavMesh_resetAreaFlags_doc,
+             "Restore built flags of polygons with the area ID.\n"
+             "\n"
+             "NavMesh.resetAreaFlags(areaId)\n"
+             "\n"
+             "Parameters\n"
+             "----------\n"
+             "    areaId: int\n"
+             "        Navigation area ID\n");
+
 // getAABB
 PyDoc_STRVAR(NavMesh_getAABB_doc,
              "Return the bounding box of this NavMesh.\n"
@@ -60,9 +60,51 @@ namespace ige::scene
         return -1;
     }
 
+    // Shape
+    PyObject *NavObstacle_getShape(PyObject_NavObstacle *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong((int)std::dynamic_pointer_cast<NavObstacle>(self->component.lock())->getShape());
+    }
+
+    int NavObstacle_setShape(PyObject_NavObstacle *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (uint32_t)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<NavObstacle>(self->component.lock())->setShape((NavObstacle::Shape)val);
+            return 0;
+        }
+        return -1;
+    }
+
+    // Size
+    PyObject *NavObstacle_getSize(PyObject_NavObstacle *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto vec3Obj = PyObject_New(vec_obj, _Vec3Type);
+        vmath_cpy(std::dynamic_pointer_cast<NavObstacle>(self->component.lock())->getSize().P(), 3, vec3Obj->v);
+        vec3Obj->d = 3;
+        return (PyObject *)vec3Obj;
+    }
+
+    int NavObstacle_setSize(PyObject_NavObstacle *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        int d;
+        float buff[4];
+        auto v = pyObjToFloat((PyObject *)value, buff, d);
+        if (!v)
+            return -1;
+        std::dynamic_pointer_cast<NavObstacle>(self->component.lock())->setSize(*((Vec3 *)v));
+        return 0;
+    }
+
     PyGetSetDef NavObstacle_getsets[] = {
         {"radius", (getter)NavObstacle_getRadius, (setter)NavObstacle_setRadius, NavObstacle_radius_doc, NULL},
         {"height", (getter)NavObstacle_getHeight, (setter)NavObstacle_setHeight, NavObstacle_height_doc, NULL},
+        {"shape", (getter)NavObstacle_getShape, (setter)NavObstacle_setShape, NavObstacle_shape_doc, NULL},
+        {"size", (getter)NavObstacle_getSize, (setter)NavObstacle_setSize, NavObstacle_size_doc, NULL},
         {NULL, NULL}};
 
     PyTypeObject PyTypeObject_NavObstacle = {
@@ -27,4 +27,12 @@ namespace ige::scene
     //! Height
     PyObject *NavObstacle_getHeight(PyObject_NavObstacle *self);
     int NavObstacle_setHeight(PyObject_NavObstacle *self, PyObject *value);
+
+    //! Shape
+    PyObject *NavObstacle_getShape(PyObject_NavObstacle *self);
+    int NavObstacle_setShape(PyObject_NavObstacle *self, PyObject *value);
+
+    //! Size
+    PyObject *NavObstacle_getSize(PyObject_NavObstacle *self);
+    int NavObstacle_setSize(PyObject_NavObstacle *self, PyObject *value);
 } // namespace ige::scene
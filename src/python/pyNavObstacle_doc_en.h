@@ -12,3 +12,12 @@ PyDoc_STRVAR(NavObstacle_height_doc,
              "Obstacle height\n"
              "Type: float\n");
 
+// shape
+PyDoc_STRVAR(NavObstacle_shape_doc,
+             "Obstacle shape: 0 = cylinder, 1 = box, 2 = box rotated by the owner yaw.\n"
+             "Type: int\n");
+
+// size
+PyDoc_STRVAR(NavObstacle_size_doc,
+             "Box size, the box stands on the owner position.\n"
+             "Type: Vec3\n");
@@ -87,7 +87,7 @@ namespace ige::scene
             Py_RETURN_NONE;
 
         auto hitObj = (PyObject_SceneObject*)(&PyTypeObject_SceneObject)->tp_alloc(&PyTypeObject_SceneObject, 0);
-        hitObj->sceneObject = reinterpret_cast<Rigidbody *>(hit.object->getUserPointer())->getOwner()->getSharedPtr();
+        hitObj->sceneObject = PhysicManager::getSceneObject(hit.object)->getSharedPtr();
 
         auto hitPos = PyObject_New(vec_obj, _Vec3Type);
         vmath_cpy(PhysicHelper::from_btVector3(hit.position).P(), 3, hitPos->v);
@@ -141,7 +141,7 @@ namespace ige::scene
                 Py_RETURN_NONE;
 
             auto hitObj = (PyObject_SceneObject*)(&PyTypeObject_SceneObject)->tp_alloc(&PyTypeObject_SceneObject, 0);
-            hitObj->sceneObject = reinterpret_cast<Rigidbody *>(hits[i].object->getUserPointer())->getOwner()->getSharedPtr();
+            hitObj->sceneObject = PhysicManager::getSceneObject(hits[i].object)->getSharedPtr();
 
             auto hitPos = PyObject_New(vec_obj, _Vec3Type);
             vmath_cpy(PhysicHelper::from_btVector3(hits[i].position).P(), 3, hitPos->v);
@@ -206,10 +206,10 @@ namespace ige::scene
             const auto &result = results[i];
 
             auto objectA = (PyObject_SceneObject*)(&PyTypeObject_SceneObject)->tp_alloc(&PyTypeObject_SceneObject, 0);
-            objectA->sceneObject = reinterpret_cast<Rigidbody *>(result.objectA->getUserPointer())->getOwner()->getSharedPtr();
+            objectA->sceneObject = PhysicManager::getSceneObject(result.objectA)->getSharedPtr();
 
             auto objectB = (PyObject_SceneObject*)(&PyTypeObject_SceneObject)->tp_alloc(&PyTypeObject_SceneObject, 0);
-            objectB->sceneObject = reinterpret_cast<Rigidbody *>(result.objectB->getUserPointer())->getOwner()->getSharedPtr();
+            objectB->sceneObject = PhysicManager::getSceneObject(result.objectB)->getSharedPtr();
 
             auto localPosA = PyObject_New(vec_obj, _Vec3Type);
             vmath_cpy(PhysicHelper::from_btVector3(result.localPosA).P(), 3, localPosA->v);
@@ -304,10 +304,10 @@ namespace ige::scene
             const auto &result = results[i];
 
             auto objectA = (PyObject_SceneObject*)(&PyTypeObject_SceneObject)->tp_alloc(&PyTypeObject_SceneObject, 0);
-            objectA->sceneObject = reinterpret_cast<Rigidbody *>(result.objectA->getUserPointer())->getOwner()->getSharedPtr();
+            objectA->sceneObject = PhysicManager::getSceneObject(result.objectA)->getSharedPtr();
 
             auto objectB = (PyObject_SceneObject*)(&PyTypeObject_SceneObject)->tp_alloc(&PyTypeObject_SceneObject, 0);
-            objectB->sceneObject = reinterpret_cast<Rigidbody *>(result.objectB->getUserPointer())->getOwner()->getSharedPtr();
+            objectB->sceneObject = PhysicManager::getSceneObject(result.objectB)->getSharedPtr();
 
             auto localPosA = PyObject_New(vec_obj, _Vec3Type);
             vmath_cpy(PhysicHelper::from_btVector3(result.localPosA).P(), 3, localPosA->v);
@@ -442,6 +442,149 @@ namespace ige::scene
         return -1;
     }
 
+    // Get parallel soft body
+    PyObject *PhysicManager_isParallelSoftBody(PyObject_PhysicManager *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyBool_FromLong(std::dynamic_pointer_cast<PhysicManager>(self->component.lock())->isParallelSoftBody());
+    }
+
+    // Set parallel soft body
+    int PhysicManager_setParallelSoftBody(PyObject_PhysicManager *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (uint32_t)PyLong_AsLong(value) != 0;
+            std::dynamic_pointer_cast<PhysicManager>(self->component.lock())->setParallelSoftBody(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    // Get profiling
+    PyObject *PhysicManager_isProfiling(PyObject_PhysicManager *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyBool_FromLong(std::dynamic_pointer_cast<PhysicManager>(self->component.lock())->isProfiling());
+    }
+
+    // Set profiling
+    int PhysicManager_setProfiling(PyObject_PhysicManager *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (uint32_t)PyLong_AsLong(value) != 0;
+            std::dynamic_pointer_cast<PhysicManager>(self->component.lock())->setProfiling(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    // Profile report
+    PyObject *PhysicManager_getProfileReport(PyObject_PhysicManager *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        auto report = std::dynamic_pointer_cast<PhysicManager>(self->component.lock())->getProfileReport();
+        return PyUnicode_FromString(report.dump().c_str());
+    }
+
+    // Get interpolation
+    PyObject *PhysicManager_isInterpolation(PyObject_PhysicManager *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyBool_FromLong(std::dynamic_pointer_cast<PhysicManager>(self->component.lock())->isInterpolation());
+    }
+
+    // Set interpolation
+    int PhysicManager_setInterpolation(PyObject_PhysicManager *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (uint32_t)PyLong_AsLong(value) != 0;
+            std::dynamic_pointer_cast<PhysicManager>(self->component.lock())->setInterpolation(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    // Get soft body GC interval
+    PyObject *PhysicManager_getSoftBodyGCInterval(PyObject_PhysicManager *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong(std::dynamic_pointer_cast<PhysicManager>(self->component.lock())->getSoftBodyGCInterval());
+    }
+
+    // Set soft body GC interval
+    int PhysicManager_setSoftBodyGCInterval(PyObject_PhysicManager *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (int)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<PhysicManager>(self->component.lock())->setSoftBodyGCInterval(val);
+            return 0;
+        }
+        return -1;
+    }
+
+    // Get contact report
+    PyObject *PhysicManager_getContactReport(PyObject_PhysicManager *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        const auto& reports = std::dynamic_pointer_cast<PhysicManager>(self->component.lock())->getContactReports();
+        return PyBytes_FromStringAndSize((const char*)reports.data(), reports.size() * sizeof(ContactReport));
+    }
+
+    //! Save snapshot
+    PyObject *PhysicManager_saveSnapshot(PyObject_PhysicManager *self, PyObject *args)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        char* path = nullptr;
+        if (!PyArg_ParseTuple(args, "|s", &path))
+            Py_RETURN_NONE;
+        auto manager = std::dynamic_pointer_cast<PhysicManager>(self->component.lock());
+        if (path)
+            return PyBool_FromLong(manager->saveSnapshot(std::string(path)));
+        std::vector<uint8_t> data;
+        manager->saveSnapshot(data);
+        return PyBytes_FromStringAndSize((const char*)data.data(), data.size());
+    }
+
+    //! Restore snapshot
+    PyObject *PhysicManager_restoreSnapshot(PyObject_PhysicManager *self, PyObject *args)
+    {
+        if (self->component.expired()) Py_RETURN_FALSE;
+        PyObject* obj = nullptr;
+        if (!PyArg_ParseTuple(args, "O", &obj))
+            Py_RETURN_FALSE;
+        auto manager = std::dynamic_pointer_cast<PhysicManager>(self->component.lock());
+        if (PyUnicode_Check(obj))
+            return PyBool_FromLong(manager->loadSnapshot(std::string(PyUnicode_AsUTF8(obj))));
+        if (PyBytes_Check(obj))
+        {
+            auto buffer = (const uint8_t*)PyBytes_AsString(obj);
+            std::vector<uint8_t> data(buffer, buffer + PyBytes_Size(obj));
+            return PyBool_FromLong(manager->restoreSnapshot(data));
+        }
+        Py_RETURN_FALSE;
+    }
+
+    //! Preload snapshot
+    PyObject *PhysicManager_preloadSnapshot(PyObject *self, PyObject *args)
+    {
+        PyObject* obj = nullptr;
+        if (!PyArg_ParseTuple(args, "O", &obj))
+            Py_RETURN_FALSE;
+        if (PyUnicode_Check(obj))
+            return PyBool_FromLong(PhysicManager::preloadSnapshot(std::string(PyUnicode_AsUTF8(obj))));
+        if (PyBytes_Check(obj))
+        {
+            auto buffer = (const uint8_t*)PyBytes_AsString(obj);
+            std::vector<uint8_t> data(buffer, buffer + PyBytes_Size(obj));
+            return PyBool_FromLong(PhysicManager::preloadSnapshot(data));
+        }
+        Py_RETURN_FALSE;
+    }
+
     // Methods
     PyMethodDef PhysicManager_methods[] = {
         {"getInstance", (PyCFunction)PhysicManager_getInstance, METH_NOARGS | METH_STATIC, PhysicManager_getInstance_doc},
@@ -451,6 +594,11 @@ namespace ige::scene
         {"rayTestAll", (PyCFunction)PhysicManager_rayTestAll, METH_VARARGS, PhysicManager_rayTestAll_doc},
         {"contactTest", (PyCFunction)PhysicManager_contactTest, METH_VARARGS, PhysicManager_contactTest_doc},
         {"contactPairTest", (PyCFunction)PhysicManager_contactPairTest, METH_VARARGS, PhysicManager_contactPairTest_doc},
+        {"getContactReport", (PyCFunction)PhysicManager_getContactReport, METH_NOARGS, PhysicManager_getContactReport_doc},
+        {"getProfileReport", (PyCFunction)PhysicManager_getProfileReport, METH_NOARGS, PhysicManager_getProfileReport_doc},
+        {"saveSnapshot", (PyCFunction)PhysicManager_saveSnapshot, METH_VARARGS, PhysicManager_saveSnapshot_doc},
+        {"restoreSnapshot", (PyCFunction)PhysicManager_restoreSnapshot, METH_VARARGS, PhysicManager_restoreSnapshot_doc},
+        {"preloadSnapshot", (PyCFunction)PhysicManager_preloadSnapshot, METH_VARARGS | METH_STATIC, PhysicManager_preloadSnapshot_doc},
         {NULL, NULL}};
 
     // Get/Set
@@ -460,6 +608,10 @@ namespace ige::scene
         {"frameUpdateRatio", (getter)PhysicManager_getFrameUpdateRatio, (setter)PhysicManager_setFrameUpdateRatio, PhysicManager_frameUpdateRatio_doc, NULL},
         {"frameMaxSubStep", (getter)PhysicManager_getFrameMaxSubStep, (setter)PhysicManager_setFrameMaxSubStep, PhysicManager_frameMaxSubStep_doc, NULL},
         {"fixedTimeStep", (getter)PhysicManager_getFixedTimeStep, (setter)PhysicManager_setFixedTimeStep, PhysicManager_fixedTimeStep_doc, NULL},
+        {"parallelSoftBody", (getter)PhysicManager_isParallelSoftBody, (setter)PhysicManager_setParallelSoftBody, PhysicManager_parallelSoftBody_doc, NULL},
+        {"softBodyGCInterval", (getter)PhysicManager_getSoftBodyGCInterval, (setter)PhysicManager_setSoftBodyGCInterval, PhysicManager_softBodyGCInterval_doc, NULL},
+        {"profiling", (getter)PhysicManager_isProfiling, (setter)PhysicManager_setProfiling, PhysicManager_profiling_doc, NULL},
+        {"interpolation", (getter)PhysicManager_isInterpolation, (setter)PhysicManager_setInterpolation, PhysicManager_interpolation_doc, NULL},
         {NULL, NULL}};
 
     // Type declaration
@@ -40,6 +40,14 @@ namespace ige::scene
     // Contact pair test
     PyObject* PhysicManager_contactPairTest(PyObject_PhysicManager* self, PyObject* value);
 
+    // Get contact report
+    PyObject* PhysicManager_getContactReport(PyObject_PhysicManager* self);
+
+    //! Snapshot
+    PyObject* PhysicManager_saveSnapshot(PyObject_PhysicManager* self, PyObject* args);
+    PyObject* PhysicManager_restoreSnapshot(PyObject_PhysicManager* self, PyObject* args);
+    PyObject* PhysicManager_preloadSnapshot(PyObject* self, PyObject* args);
+
     // Get gravity
     PyObject *PhysicManager_getGravity(PyObject_PhysicManager *self);
 
@@ -69,4 +77,31 @@ namespace ige::scene
 
     // Set fixed time steps
     int PhysicManager_setFixedTimeStep(PyObject_PhysicManager *self, PyObject *value);
+
+    // Get parallel soft body
+    PyObject *PhysicManager_isParallelSoftBody(PyObject_PhysicManager *self);
+
+    // Set parallel soft body
+    int PhysicManager_setParallelSoftBody(PyObject_PhysicManager *self, PyObject *value);
+
+    // Get soft body GC interval
+    PyObject *PhysicManager_getSoftBodyGCInterval(PyObject_PhysicManager *self);
+
+    // Set soft body GC interval
+    int PhysicManager_setSoftBodyGCInterval(PyObject_PhysicManager *self, PyObject *value);
+
+    // Get profiling
+    PyObject *PhysicManager_isProfiling(PyObject_PhysicManager *self);
+
+    // Set profiling
+    int PhysicManager_setProfiling(PyObject_PhysicManager *self, PyObject *value);
+
+    // Profile report
+    PyObject* PhysicManager_getProfileReport(PyObject_PhysicManager* self);
+
+    // Get interpolation
+    PyObject *PhysicManager_isInterpolation(PyObject_PhysicManager *self);
+
+    // Set interpolation
+    int PhysicManager_setInterpolation(PyObject_PhysicManager *self, PyObject *value);
 } // namespace ige::scene
@@ -88,6 +88,62 @@ PyDoc_STRVAR(PhysicManager_contactPairTest_doc,
              "Return:\n"
              " Tuple of (objectA: SceneObject, objectB: SceneObject, localPosA: Vec3, localPosB: Vec3, worldPosA: Vec3, worldPosB: Vec3, normalB: Vec3) as Tuple \n");
 
+// getContactReport
+PyDoc_STRVAR(PhysicManager_getContactReport_doc,
+             "Get contacts of the last frame as a flat buffer, one record per pair.\n"
+             "Only pairs with a body having contactReport flags are included.\n"
+             "\n"
+             "PhysicManager.getInstance().getContactReport()\n"
+             "\n"
+             "Return:\n"
+             "    bytes of records, each unpacked by struct.iter_unpack('<QQII6f', data):\n"
+             "    (objectIdA, objectIdB, event: 1 enter/2 stay/4 exit, isTrigger, pointX, pointY, pointZ, normalX, normalY, normalZ)\n");
+
+// saveSnapshot
+PyDoc_STRVAR(PhysicManager_saveSnapshot_doc,
+             "Save states of all bodies: transforms, velocities, activation, soft body nodes and characters.\n"
+             "Bodies are keyed by scene object UUID and body type. Baked MeshCollider shapes are saved too, see preloadSnapshot.\n"
+             "\n"
+             "PhysicManager.getInstance().saveSnapshot(path = None)\n"
+             "\n"
+             "Parameters\n"
+             "----------\n"
+             "    [Optional]path : string\n"
+             "        file to write\n"
+             "\n"
+             "Return:\n"
+             "    snapshot as bytes, or True/False when path is given\n");
+
+// restoreSnapshot
+PyDoc_STRVAR(PhysicManager_restoreSnapshot_doc,
+             "Restore states of bodies from a snapshot. Bodies not in the world are skipped.\n"
+             "Only body states are restored, shapes are kept as built by the colliders.\n"
+             "\n"
+             "PhysicManager.getInstance().restoreSnapshot(snapshot)\n"
+             "\n"
+             "Parameters\n"
+             "----------\n"
+             "    snapshot : bytes or string\n"
+             "        snapshot data, or file path\n"
+             "\n"
+             "Return:\n"
+             "    True if restored, False otherwise\n");
+
+// preloadSnapshot
+PyDoc_STRVAR(PhysicManager_preloadSnapshot_doc,
+             "Register baked MeshCollider shapes of a snapshot before loading its scene.\n"
+             "Matching mesh colliders are then built from the snapshot, without reading figures or computing convex hulls.\n"
+             "\n"
+             "PhysicManager.preloadSnapshot(snapshot)\n"
+             "\n"
+             "Parameters\n"
+             "----------\n"
+             "    snapshot : bytes or string\n"
+             "        snapshot data, or file path\n"
+             "\n"
+             "Return:\n"
+             "    True if preloaded, False otherwise\n");
+
 // isDeformable
 PyDoc_STRVAR(PhysicManager_isDeformable_doc,
              "Check if the world is deformable.\n"
@@ -117,6 +173,35 @@ PyDoc_STRVAR(PhysicManager_fixedTimeStep_doc,
              "Fixed time steps.\n"
              "Type: float\n");
 
+// parallelSoftBody
+PyDoc_STRVAR(PhysicManager_parallelSoftBody_doc,
+             "Solve independent soft bodies in parallel (deformable world only).\n"
+             "Type: bool\n");
+
+// softBodyGCInterval
+PyDoc_STRVAR(PhysicManager_softBodyGCInterval_doc,
+             "Number of simulation steps between soft body sparse SDF garbage collections.\n"
+             "Type: int\n");
+
+// profiling
+PyDoc_STRVAR(PhysicManager_profiling_doc,
+             "Collect step counts and per-phase Bullet timings. Enabling resets the collected data.\n"
+             "Type: bool\n");
+
+// getProfileReport
+PyDoc_STRVAR(PhysicManager_getProfileReport_doc,
+             "Get the profile collected since profiling was enabled.\n"
+             "\n"
+             "PhysicManager.getInstance().getProfileReport()\n"
+             "\n"
+             "Return:\n"
+             "    JSON string: {frames, steps, time (ms), stepsPerSec, phases: {path: {time (ms), calls}}}\n");
+
+// interpolation
+PyDoc_STRVAR(PhysicManager_interpolation_doc,
+             "Interpolate body transforms between fixed steps on every frame, so physics can run at a lower rate than rendering.\n"
+             "Type: bool\n");
+
 // gravity
 PyDoc_STRVAR(PhysicManager_gravity_doc,
              "Gravity.\n"
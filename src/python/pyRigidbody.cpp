@@ -632,6 +632,24 @@ namespace ige::scene
         return -1;
     }
 
+    //! Contact report flags
+    PyObject *Rigidbody_getContactReport(PyObject_Rigidbody *self)
+    {
+        if (self->component.expired()) Py_RETURN_NONE;
+        return PyLong_FromLong(std::dynamic_pointer_cast<Rigidbody>(self->component.lock())->getContactReportFlags());
+    }
+
+    int Rigidbody_setContactReport(PyObject_Rigidbody *self, PyObject *value)
+    {
+        if (self->component.expired()) return -1;
+        if (PyLong_Check(value)) {
+            auto val = (int)PyLong_AsLong(value);
+            std::dynamic_pointer_cast<Rigidbody>(self->component.lock())->setContactReportFlags(val);
+            return 0;
+        }
+        return -1;
+    }
+
     //! Position offset
     PyObject* Rigidbody_getOffset(PyObject_Rigidbody* self)
     {
@@ -690,6 +708,7 @@ namespace ige::scene
         {"continuousDetection", (getter)Rigidbody_isCCD, (setter)Rigidbody_setCCD, Rigidbody_continuousDetection_doc, NULL},
         {"activationState", (getter)Rigidbody_getActivationState, (setter)Rigidbody_setActivationState, Rigidbody_activationState_doc, NULL},
         {"offset", (getter)Rigidbody_getOffset, (setter)Rigidbody_setOffset, Rigidbody_offset_doc, NULL},
+        {"contactReport", (getter)Rigidbody_getContactReport, (setter)Rigidbody_setContactReport, Rigidbody_contactReport_doc, NULL},
         {NULL, NULL},
     };
 
@@ -114,6 +114,10 @@ namespace ige::scene
     PyObject* Rigidbody_isCCD(PyObject_Rigidbody* self);
     int Rigidbody_setCCD(PyObject_Rigidbody* self, PyObject* value);
 
+    //! Contact report flags
+    PyObject* Rigidbody_getContactReport(PyObject_Rigidbody* self);
+    int Rigidbody_setContactReport(PyObject_Rigidbody* self, PyObject* value);
+
     //! Position offset
     PyObject* Rigidbody_getOffset(PyObject_Rigidbody* self);
     int Rigidbody_setOffset(PyObject_Rigidbody* self, PyObject* value);
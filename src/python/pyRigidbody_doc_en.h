@@ -155,6 +155,12 @@ PyDoc_STRVAR(Rigidbody_collisionMask_doc,
              "Collision filter mask.\n"
              "Type: int\n");
 
+// contactReport
+PyDoc_STRVAR(Rigidbody_contactReport_doc,
+             "Contact report flags. Contacts are only reported for bodies with flags.\n"
+             "Values: 0: none, 1: enter, 2: stay, 4: exit, 7: all\n"
+             "Type: int\n");
+
 // continuousDetection
 PyDoc_STRVAR(Rigidbody_continuousDetection_doc,
              "Continuous Colision Detection.\n"
@@ -32,7 +32,9 @@
 #include "python/pySphereCollider.h"
 #include "python/pyCapsuleCollider.h"
 #include "python/pyMeshCollider.h"
+#include "python/pyHeightfieldCollider.h"
 #include "python/pySoftbody.h"
+#include "python/pyCharacterController.h"
 #include "python/pyPhysicConstraint.h"
 #include "python/pyDof6Constraint.h"
 #include "python/pyFixedConstraint.h"
@@ -403,6 +405,11 @@ namespace ige::scene
                 compObj->component = self->sceneObject.lock()->addComponent<MeshCollider>();
                 return (PyObject*)compObj;
             }
+            else if (type == "HeightfieldCollider") {
+                auto compObj = (PyObject_HeightfieldCollider*)(&PyTypeObject_HeightfieldCollider)->tp_alloc(&PyTypeObject_HeightfieldCollider, 0);
+                compObj->component = self->sceneObject.lock()->addComponent<HeightfieldCollider>();
+                return (PyObject*)compObj;
+            }
             else if (type == "Rigidbody") {
                 auto compObj = (PyObject_Rigidbody*)(&PyTypeObject_Rigidbody)->tp_alloc(&PyTypeObject_Rigidbody, 0);
                 compObj->component = self->sceneObject.lock()->addComponent<Rigidbody>();
@@ -413,6 +420,11 @@ namespace ige::scene
                 compObj->component = self->sceneObject.lock()->addComponent<Softbody>();
                 return (PyObject*)compObj;
             }
+            else if (type == "CharacterController") {
+                auto compObj = (PyObject_CharacterController*)(&PyTypeObject_CharacterController)->tp_alloc(&PyTypeObject_CharacterController, 0);
+                compObj->component = self->sceneObject.lock()->addComponent<CharacterController>();
+                return (PyObject*)compObj;
+            }
             else if (type == "AudioManager") {
                 auto compObj = (PyObject_AudioManager*)(&PyTypeObject_AudioManager)->tp_alloc(&PyTypeObject_AudioManager, 0);
                 compObj->component = self->sceneObject.lock()->addComponent<AudioManager>();
@@ -744,6 +756,14 @@ namespace ige::scene
                 return (PyObject*)compObj;
             }
         }
+        else if (type == "HeightfieldCollider") {
+            auto comp = sceneObject->getComponent<HeightfieldCollider>();
+            if (comp) {
+                auto* compObj = (PyObject_HeightfieldCollider*)(&PyTypeObject_HeightfieldCollider)->tp_alloc(&PyTypeObject_HeightfieldCollider, 0);
+                compObj->component = comp;
+                return (PyObject*)compObj;
+            }
+        }
         else if (type == "Rigidbody") {
             auto comp = sceneObject->getComponent<Rigidbody>();
             if (comp) {
@@ -760,6 +780,14 @@ namespace ige::scene
                 return (PyObject*)compObj;
             }
         }
+        else if (type == "CharacterController") {
+            auto comp = sceneObject->getComponent<CharacterController>();
+            if (comp) {
+                auto* compObj = (PyObject_CharacterController*)(&PyTypeObject_CharacterController)->tp_alloc(&PyTypeObject_CharacterController, 0);
+                compObj->component = comp;
+                return (PyObject*)compObj;
+            }
+        }
         else if (type == "AudioManager") {
             auto comp = sceneObject->getComponent<AudioManager>();
             if (comp) {
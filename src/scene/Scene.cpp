@@ -23,9 +23,11 @@
 #include "components/gui/Canvas.h"
 #include "components/gui/UIImage.h"
 #include "components/tween/TweenManager.h"
+#include "components/animation/AnimatorComponent.h"
 
 #include "utils/GraphicsHelper.h"
 #include "utils/RayOBBChecker.h"
+#include "utils/ThreadPool.h"
 
 #include "utils/filesystem.h"
 namespace fs = ghc::filesystem;
@@ -239,6 +241,8 @@ namespace ige::scene
 
     void Scene::update(float dt)
     {
+        updateAnimations(dt);
+
         for (int i = m_objects.size() - 1; i >= 0; i--) {
             m_objects[i]->onUpdate(dt);
         }
@@ -255,6 +259,32 @@ namespace ige::scene
     #endif
     }
 
+    //! Animation phase: transform sync and culling run here, controllers and figure steps run in parallel
+    void Scene::updateAnimations(float dt)
+    {
+        if (!SceneManager::getInstance()->isPlaying())
+            return;
+
+        for (int i = m_objects.size() - 1; i >= 0; i--) {
+            if (!m_objects[i]->isActive())
+                continue;
+            auto animator = m_objects[i]->getComponent<AnimatorComponent>();
+            if (animator && animator->isEnabled() && animator->prepareAnimation(dt))
+                m_frameAnimators.push_back(animator);
+        }
+
+        // Each animator only touches its own controller instance and figure
+        ThreadPool::getInstance()->parallelFor((int)m_frameAnimators.size(), [&](int begin, int end) {
+            for (int i = begin; i < end; ++i)
+                m_frameAnimators[i]->evaluateAnimation();
+        }, 4);
+
+        // State listeners may run scripts, so they are invoked back on the main thread
+        for (const auto& animator : m_frameAnimators)
+            animator->dispatchStateEvents();
+        m_frameAnimators.clear();
+    }
+
     void Scene::fixedUpdate(float dt)
     {
         for (int i = m_objects.size() - 1; i >= 0; i--)
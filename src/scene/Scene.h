@@ -16,6 +16,7 @@
 
 namespace ige::scene
 {
+    class AnimatorComponent;
     class SceneObject;
     class TweenManager;
     class TargetObject;
@@ -234,6 +235,9 @@ namespace ige::scene
         //! Reset flag
         virtual void resetFlag();
 
+        //! Animation phase: controllers and figure steps of animated objects, run in parallel
+        void updateAnimations(float dt);
+
     protected:
         //! Scene root node
         std::weak_ptr<SceneObject> m_root;
@@ -247,6 +251,9 @@ namespace ige::scene
         //! Cache all objects
         std::vector<std::shared_ptr<SceneObject>> m_objects;
 
+        //! Animators evaluated in the current animation phase
+        std::vector<std::shared_ptr<AnimatorComponent>> m_frameAnimators;
+
         //! Showcase which contains all rendering resources
         Showcase* m_showcase = nullptr;
 
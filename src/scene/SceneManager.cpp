@@ -12,6 +12,7 @@
 #include "components/FigureComponent.h"
 #include "components/light/AmbientLight.h"
 #include "components/light/DirectionalLight.h"
+#include "components/navigation/NavMesh.h"
 
 #include <Python.h>
 
@@ -339,6 +340,16 @@ namespace ige::scene
             std::ofstream file(fsPath.string());
             file << std::setw(2) << jScene << std::endl;
             file.close();
+
+            // Baked navigation tiles are stored next to the scene file
+            if (path.find(".tmp") == std::string::npos)
+            {
+                for (auto& obj : m_currScene->getObjects())
+                {
+                    if (auto navMesh = obj ? obj->getComponent<NavMesh>() : nullptr)
+                        navMesh->saveBakedData();
+                }
+            }
             return true;
         }
         return false;
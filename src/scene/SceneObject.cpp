@@ -30,6 +30,8 @@
 #include "components/physic/collider/CapsuleCollider.h"
 #include "components/physic/collider/SphereCollider.h"
 #include "components/physic/collider/MeshCollider.h"
+#include "components/physic/collider/HeightfieldCollider.h"
+#include "components/physic/CharacterController.h"
 #include "components/physic/collider/CompoundCollider.h"
 #include "components/physic/Softbody.h"
 #include "components/audio/AudioManager.h"
@@ -324,8 +326,10 @@ namespace ige::scene
         if (name == "CapsuleCollider") return addComponent<CapsuleCollider>();
         if (name == "CompoundCollider") return addComponent<CompoundCollider>();
         if (name == "MeshCollider") return addComponent<MeshCollider>();
+        if (name == "HeightfieldCollider") return addComponent<HeightfieldCollider>();
         if (name == "Rigidbody") return addComponent<Rigidbody>();
         if (name == "Softbody") return addComponent<Softbody>();
+        if (name == "CharacterController") return addComponent<CharacterController>();
         if (name == "UIImage") return addComponent<UIImage>();
         if (name == "UIText") return addComponent<UIText>();
         if (name == "UITextField") return addComponent<UITextField>();
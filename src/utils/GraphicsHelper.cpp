@@ -451,6 +451,29 @@ namespace ige::scene
         return (r2[0] >= r1[0] && r2[2] <= r1[2] && r2[1] >= r1[1] && r2[3] <= r1[3]);
     }
 
+    bool AabbInFrustum(const AABBox& aabb, const Mat4& viewProj)
+    {
+        // Outside only if all corners are outside of the same clip plane
+        uint32_t outside = 0x3F;
+        for (int i = 0; i < 8; ++i)
+        {
+            auto clip = viewProj * Vec4((i & 1) ? aabb.MaxEdge.X() : aabb.MinEdge.X(),
+                                        (i & 2) ? aabb.MaxEdge.Y() : aabb.MinEdge.Y(),
+                                        (i & 4) ? aabb.MaxEdge.Z() : aabb.MinEdge.Z(), 1.f);
+            uint32_t code = 0;
+            if (clip.X() < -clip.W()) code |= 0x01;
+            if (clip.X() > clip.W()) code |= 0x02;
+            if (clip.Y() < -clip.W()) code |= 0x04;
+            if (clip.Y() > clip.W()) code |= 0x08;
+            if (clip.Z() < -clip.W()) code |= 0x10;
+            if (clip.Z() > clip.W()) code |= 0x20;
+            outside &= code;
+            if (outside == 0)
+                return true;
+        }
+        return false;
+    }
+
     //! Generate UUID
     std::string generateUUID(unsigned int len)
     {
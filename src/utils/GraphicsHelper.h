@@ -31,5 +31,8 @@ namespace ige::scene
     Vec4 AabbToScreenRect(const AABBox& aabb, const Vec2& windowSize, Camera* cam);
     bool RectInside(const Vec4& r1, const Vec4& r2);
 
+    //! Whether the world space AABB touches the frustum of the view projection matrix
+    bool AabbInFrustum(const AABBox& aabb, const Mat4& viewProj);
+
     std::string generateUUID(unsigned int len = 16);
 }
@@ -0,0 +1,101 @@
+#include "utils/ThreadPool.h"
+
+#include <algorithm>
+
+namespace ige::scene
+{
+    //! Constructor
+    ThreadPool::ThreadPool()
+    {
+        // Keep one core for the main thread
+        int numThreads = std::max((int)std::thread::hardware_concurrency() - 1, 1);
+        for (int i = 0; i < numThreads; ++i)
+            m_workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+
+    //! Destructor
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_bStop = true;
+        }
+        m_condition.notify_all();
+        for (auto& worker : m_workers)
+        {
+            if (worker.joinable())
+                worker.join();
+        }
+        m_workers.clear();
+    }
+
+    //! Worker loop
+    void ThreadPool::workerLoop()
+    {
+        while (true)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this] { return m_bStop || !m_jobs.empty(); });
+                if (m_bStop && m_jobs.empty())
+                    return;
+                job = std::move(m_jobs.front());
+                m_jobs.pop();
+            }
+            job();
+        }
+    }
+
+    //! Parallel for
+    void ThreadPool::parallelFor(int count, const std::function<void(int, int)>& func, int minChunkSize)
+    {
+        if (count <= 0)
+            return;
+
+        int numChunks = std::min(getNumThreads() + 1, (count + minChunkSize - 1) / std::max(minChunkSize, 1));
+        if (numChunks <= 1)
+        {
+            func(0, count);
+            return;
+        }
+
+        struct Context
+        {
+            std::atomic<int> next = {0};
+            std::atomic<int> done = {0};
+            std::mutex mutex;
+            std::condition_variable condition;
+        };
+        auto context = std::make_shared<Context>();
+        int chunkSize = (count + numChunks - 1) / numChunks;
+
+        // Pull chunks until none left, shared by workers and the calling thread
+        auto runChunks = [context, &func, count, chunkSize, numChunks]() {
+            int chunk;
+            while ((chunk = context->next.fetch_add(1)) < numChunks)
+            {
+                int begin = chunk * chunkSize;
+                func(begin, std::min(begin + chunkSize, count));
+                if (context->done.fetch_add(1) + 1 == numChunks)
+                {
+                    std::unique_lock<std::mutex> lock(context->mutex);
+                    context->condition.notify_all();
+                }
+            }
+        };
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            for (int i = 0; i < numChunks - 1; ++i)
+                m_jobs.emplace(runChunks);
+        }
+        m_condition.notify_all();
+
+        runChunks();
+
+        // Late workers find no chunk left and return without touching func
+        std::unique_lock<std::mutex> lock(context->mutex);
+        context->condition.wait(lock, [&context, numChunks] { return context->done.load() == numChunks; });
+    }
+} // namespace ige::scene
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "utils/Singleton.h"
+
+namespace ige::scene
+{
+    /**
+     * Class ThreadPool: shared worker threads for parallel engine jobs
+     */
+    class ThreadPool : public Singleton<ThreadPool>
+    {
+    public:
+        //! Constructor
+        ThreadPool();
+
+        //! Destructor
+        virtual ~ThreadPool();
+
+        //! Number of worker threads
+        int getNumThreads() const { return (int)m_workers.size(); }
+
+        //! Enqueue a job, the result is returned through the future
+        template <typename F>
+        auto enqueue(F&& job) -> std::future<decltype(job())>;
+
+        //! Run func(begin, end) over [0, count) in chunks and wait for completion.
+        //! The calling thread works on chunks too, so nested calls never deadlock.
+        void parallelFor(int count, const std::function<void(int, int)>& func, int minChunkSize = 1);
+
+    protected:
+        //! Worker loop
+        void workerLoop();
+
+    protected:
+        //! Worker threads
+        std::vector<std::thread> m_workers;
+
+        //! Pending jobs
+        std::queue<std::function<void()>> m_jobs;
+
+        //! Jobs lock
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+
+        //! Stop flag
+        bool m_bStop = false;
+    };
+
+    //! Enqueue a job
+    template <typename F>
+    inline auto ThreadPool::enqueue(F&& job) -> std::future<decltype(job())>
+    {
+        using R = decltype(job());
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(job));
+        auto result = task->get_future();
+        if (m_workers.empty())
+        {
+            (*task)();
+            return result;
+        }
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobs.emplace([task]() { (*task)(); });
+        }
+        m_condition.notify_one();
+        return result;
+    }
+} // namespace ige::scene